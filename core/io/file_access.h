@@ -148,6 +148,7 @@ public:
 	Variant get_var(bool p_allow_objects = false) const;
 
 	virtual uint64_t get_buffer(uint8_t *p_dst, uint64_t p_length) const; ///< get an array of bytes
+	virtual const uint8_t *map_read_only() { return nullptr; } ///< map the whole file (get_length() bytes) in memory until closed, or null if not supported
 	Vector<uint8_t> get_buffer(int64_t p_length) const;
 	virtual String get_line() const;
 	virtual String get_token() const;
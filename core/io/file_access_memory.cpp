@@ -32,6 +32,7 @@
 
 #include "core/config/project_settings.h"
 #include "core/io/dir_access.h"
+#include "core/io/marshalls.h"
 #include "core/templates/rb_map.h"
 
 static HashMap<String, Vector<uint8_t>> *files = nullptr;
@@ -132,6 +133,36 @@ uint8_t FileAccessMemory::get_8() const {
 	return ret;
 }
 
+uint16_t FileAccessMemory::get_16() const {
+	if (pos + 2 > length) {
+		return FileAccess::get_16(); // Reads past the end byte by byte.
+	}
+	uint16_t ret = decode_uint16(&data[pos]);
+	pos += 2;
+
+	return big_endian ? BSWAP16(ret) : ret;
+}
+
+uint32_t FileAccessMemory::get_32() const {
+	if (pos + 4 > length) {
+		return FileAccess::get_32();
+	}
+	uint32_t ret = decode_uint32(&data[pos]);
+	pos += 4;
+
+	return big_endian ? BSWAP32(ret) : ret;
+}
+
+uint64_t FileAccessMemory::get_64() const {
+	if (pos + 8 > length) {
+		return FileAccess::get_64();
+	}
+	uint64_t ret = decode_uint64(&data[pos]);
+	pos += 8;
+
+	return big_endian ? BSWAP64(ret) : ret;
+}
+
 uint64_t FileAccessMemory::get_buffer(uint8_t *p_dst, uint64_t p_length) const {
 	ERR_FAIL_COND_V(!p_dst && p_length > 0, -1);
 	ERR_FAIL_NULL_V(data, -1);
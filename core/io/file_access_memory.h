@@ -56,6 +56,9 @@ public:
 	virtual bool eof_reached() const override; ///< reading passed EOF
 
 	virtual uint8_t get_8() const override; ///< get a byte
+	virtual uint16_t get_16() const override; ///< get 16 bits uint
+	virtual uint32_t get_32() const override; ///< get 32 bits uint
+	virtual uint64_t get_64() const override; ///< get 64 bits uint
 
 	virtual uint64_t get_buffer(uint8_t *p_dst, uint64_t p_length) const override; ///< get an array of bytes
 
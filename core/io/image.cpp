@@ -35,6 +35,7 @@
 #include "core/io/image_loader.h"
 #include "core/io/resource_loader.h"
 #include "core/math/math_funcs.h"
+#include "core/object/worker_thread_pool.h"
 #include "core/string/print_string.h"
 #include "core/templates/hash_map.h"
 #include "core/variant/dictionary.h"
@@ -664,6 +665,59 @@ Image::Format Image::get_format() const {
 	return format;
 }
 
+// Resizing and mipmap generation compute every destination row independently, so large
+// images are split into bands of rows that run on the WorkerThreadPool. The result is the
+// same as processing all rows on the calling thread, which is what small images do.
+static const uint64_t IMAGE_PARALLEL_MIN_PIXELS = 256 * 256;
+static const uint32_t IMAGE_PARALLEL_MIN_BAND_ROWS = 16;
+
+typedef void (*ImageRowsFunc)(const uint8_t *__restrict p_src, uint8_t *__restrict p_dst, uint32_t p_src_width, uint32_t p_src_height, uint32_t p_dst_width, uint32_t p_dst_height, uint32_t p_dst_row_from, uint32_t p_dst_row_to);
+
+struct ImageRowsTask {
+	ImageRowsFunc func = nullptr;
+	const uint8_t *src = nullptr;
+	uint8_t *dst = nullptr;
+	uint32_t src_width = 0;
+	uint32_t src_height = 0;
+	uint32_t dst_width = 0;
+	uint32_t dst_height = 0;
+	uint32_t band_rows = 0;
+};
+
+static void _process_image_rows_band(void *p_userdata, uint32_t p_band) {
+	const ImageRowsTask *task = (const ImageRowsTask *)p_userdata;
+	uint32_t from = p_band * task->band_rows;
+	uint32_t to = MIN(from + task->band_rows, task->dst_height);
+	task->func(task->src, task->dst, task->src_width, task->src_height, task->dst_width, task->dst_height, from, to);
+}
+
+static void _process_image_rows(ImageRowsFunc p_func, const uint8_t *p_src, uint8_t *p_dst, uint32_t p_src_width, uint32_t p_src_height, uint32_t p_dst_width, uint32_t p_dst_height) {
+	WorkerThreadPool *pool = WorkerThreadPool::get_singleton();
+	uint32_t thread_count = pool ? pool->get_thread_count() : 0;
+
+	if (thread_count < 2 || uint64_t(p_dst_width) * p_dst_height < IMAGE_PARALLEL_MIN_PIXELS || p_dst_height < IMAGE_PARALLEL_MIN_BAND_ROWS * 2) {
+		p_func(p_src, p_dst, p_src_width, p_src_height, p_dst_width, p_dst_height, 0, p_dst_height);
+		return;
+	}
+
+	// A few bands per thread, so threads that finish early can pick up the remaining work.
+	uint32_t band_count = MIN(thread_count * 4, p_dst_height / IMAGE_PARALLEL_MIN_BAND_ROWS);
+
+	ImageRowsTask task;
+	task.func = p_func;
+	task.src = p_src;
+	task.dst = p_dst;
+	task.src_width = p_src_width;
+	task.src_height = p_src_height;
+	task.dst_width = p_dst_width;
+	task.dst_height = p_dst_height;
+	task.band_rows = (p_dst_height + band_count - 1) / band_count;
+	band_count = (p_dst_height + task.band_rows - 1) / task.band_rows;
+
+	WorkerThreadPool::GroupID group_task = pool->add_native_group_task(&_process_image_rows_band, &task, band_count, -1, true, SNAME("ImageProcessRows"));
+	pool->wait_for_group_task_completion(group_task);
+}
+
 static double _bicubic_interp_kernel(double x) {
 	x = ABS(x);
 
@@ -679,7 +733,7 @@ static double _bicubic_interp_kernel(double x) {
 }
 
 template <int CC, class T>
-static void _scale_cubic(const uint8_t *__restrict p_src, uint8_t *__restrict p_dst, uint32_t p_src_width, uint32_t p_src_height, uint32_t p_dst_width, uint32_t p_dst_height) {
+static void _scale_cubic(const uint8_t *__restrict p_src, uint8_t *__restrict p_dst, uint32_t p_src_width, uint32_t p_src_height, uint32_t p_dst_width, uint32_t p_dst_height, uint32_t p_dst_row_from, uint32_t p_dst_row_to) {
 	// get source image size
 	int width = p_src_width;
 	int height = p_src_height;
@@ -694,7 +748,7 @@ static void _scale_cubic(const uint8_t *__restrict p_src, uint8_t *__restrict p_
 	int xmax = width - 1;
 	// temporary pointer
 
-	for (uint32_t y = 0; y < p_dst_height; y++) {
+	for (uint32_t y = p_dst_row_from; y < p_dst_row_to; y++) {
 		// Y coordinates
 		oy = (double)y * yfac - 0.5f;
 		oy1 = (int)oy;
@@ -766,7 +820,7 @@ static void _scale_cubic(const uint8_t *__restrict p_src, uint8_t *__restrict p_
 }
 
 template <int CC, class T>
-static void _scale_bilinear(const uint8_t *__restrict p_src, uint8_t *__restrict p_dst, uint32_t p_src_width, uint32_t p_src_height, uint32_t p_dst_width, uint32_t p_dst_height) {
+static void _scale_bilinear(const uint8_t *__restrict p_src, uint8_t *__restrict p_dst, uint32_t p_src_width, uint32_t p_src_height, uint32_t p_dst_width, uint32_t p_dst_height, uint32_t p_dst_row_from, uint32_t p_dst_row_to) {
 	enum {
 		FRAC_BITS = 8,
 		FRAC_LEN = (1 << FRAC_BITS),
@@ -774,7 +828,7 @@ static void _scale_bilinear(const uint8_t *__restrict p_src, uint8_t *__restrict
 		FRAC_MASK = FRAC_LEN - 1
 	};
 
-	for (uint32_t i = 0; i < p_dst_height; i++) {
+	for (uint32_t i = p_dst_row_from; i < p_dst_row_to; i++) {
 		// Add 0.5 in order to interpolate based on pixel center
 		uint32_t src_yofs_up_fp = (i + 0.5) * p_src_height * FRAC_LEN / p_dst_height;
 		// Calculate nearest src pixel center above current, and truncate to get y index
@@ -856,8 +910,8 @@ static void _scale_bilinear(const uint8_t *__restrict p_src, uint8_t *__restrict
 }
 
 template <int CC, class T>
-static void _scale_nearest(const uint8_t *__restrict p_src, uint8_t *__restrict p_dst, uint32_t p_src_width, uint32_t p_src_height, uint32_t p_dst_width, uint32_t p_dst_height) {
-	for (uint32_t i = 0; i < p_dst_height; i++) {
+static void _scale_nearest(const uint8_t *__restrict p_src, uint8_t *__restrict p_dst, uint32_t p_src_width, uint32_t p_src_height, uint32_t p_dst_width, uint32_t p_dst_height, uint32_t p_dst_row_from, uint32_t p_dst_row_to) {
+	for (uint32_t i = p_dst_row_from; i < p_dst_row_to; i++) {
 		uint32_t src_yofs = i * p_src_height / p_dst_height;
 		uint32_t y_ofs = src_yofs * p_src_width * CC;
 
@@ -1083,47 +1137,47 @@ void Image::resize(int p_width, int p_height, Interpolation p_interpolation) {
 			if (format >= FORMAT_L8 && format <= FORMAT_RGBA8) {
 				switch (get_format_pixel_size(format)) {
 					case 1:
-						_scale_nearest<1, uint8_t>(r_ptr, w_ptr, width, height, p_width, p_height);
+						_process_image_rows(_scale_nearest<1, uint8_t>, r_ptr, w_ptr, width, height, p_width, p_height);
 						break;
 					case 2:
-						_scale_nearest<2, uint8_t>(r_ptr, w_ptr, width, height, p_width, p_height);
+						_process_image_rows(_scale_nearest<2, uint8_t>, r_ptr, w_ptr, width, height, p_width, p_height);
 						break;
 					case 3:
-						_scale_nearest<3, uint8_t>(r_ptr, w_ptr, width, height, p_width, p_height);
+						_process_image_rows(_scale_nearest<3, uint8_t>, r_ptr, w_ptr, width, height, p_width, p_height);
 						break;
 					case 4:
-						_scale_nearest<4, uint8_t>(r_ptr, w_ptr, width, height, p_width, p_height);
+						_process_image_rows(_scale_nearest<4, uint8_t>, r_ptr, w_ptr, width, height, p_width, p_height);
 						break;
 				}
 			} else if (format >= FORMAT_RF && format <= FORMAT_RGBAF) {
 				switch (get_format_pixel_size(format)) {
 					case 4:
-						_scale_nearest<1, float>(r_ptr, w_ptr, width, height, p_width, p_height);
+						_process_image_rows(_scale_nearest<1, float>, r_ptr, w_ptr, width, height, p_width, p_height);
 						break;
 					case 8:
-						_scale_nearest<2, float>(r_ptr, w_ptr, width, height, p_width, p_height);
+						_process_image_rows(_scale_nearest<2, float>, r_ptr, w_ptr, width, height, p_width, p_height);
 						break;
 					case 12:
-						_scale_nearest<3, float>(r_ptr, w_ptr, width, height, p_width, p_height);
+						_process_image_rows(_scale_nearest<3, float>, r_ptr, w_ptr, width, height, p_width, p_height);
 						break;
 					case 16:
-						_scale_nearest<4, float>(r_ptr, w_ptr, width, height, p_width, p_height);
+						_process_image_rows(_scale_nearest<4, float>, r_ptr, w_ptr, width, height, p_width, p_height);
 						break;
 				}
 
 			} else if (format >= FORMAT_RH && format <= FORMAT_RGBAH) {
 				switch (get_format_pixel_size(format)) {
 					case 2:
-						_scale_nearest<1, uint16_t>(r_ptr, w_ptr, width, height, p_width, p_height);
+						_process_image_rows(_scale_nearest<1, uint16_t>, r_ptr, w_ptr, width, height, p_width, p_height);
 						break;
 					case 4:
-						_scale_nearest<2, uint16_t>(r_ptr, w_ptr, width, height, p_width, p_height);
+						_process_image_rows(_scale_nearest<2, uint16_t>, r_ptr, w_ptr, width, height, p_width, p_height);
 						break;
 					case 6:
-						_scale_nearest<3, uint16_t>(r_ptr, w_ptr, width, height, p_width, p_height);
+						_process_image_rows(_scale_nearest<3, uint16_t>, r_ptr, w_ptr, width, height, p_width, p_height);
 						break;
 					case 8:
-						_scale_nearest<4, uint16_t>(r_ptr, w_ptr, width, height, p_width, p_height);
+						_process_image_rows(_scale_nearest<4, uint16_t>, r_ptr, w_ptr, width, height, p_width, p_height);
 						break;
 				}
 			}
@@ -1170,46 +1224,46 @@ void Image::resize(int p_width, int p_height, Interpolation p_interpolation) {
 				if (format >= FORMAT_L8 && format <= FORMAT_RGBA8) {
 					switch (get_format_pixel_size(format)) {
 						case 1:
-							_scale_bilinear<1, uint8_t>(src_ptr, w_ptr, src_width, src_height, p_width, p_height);
+							_process_image_rows(_scale_bilinear<1, uint8_t>, src_ptr, w_ptr, src_width, src_height, p_width, p_height);
 							break;
 						case 2:
-							_scale_bilinear<2, uint8_t>(src_ptr, w_ptr, src_width, src_height, p_width, p_height);
+							_process_image_rows(_scale_bilinear<2, uint8_t>, src_ptr, w_ptr, src_width, src_height, p_width, p_height);
 							break;
 						case 3:
-							_scale_bilinear<3, uint8_t>(src_ptr, w_ptr, src_width, src_height, p_width, p_height);
+							_process_image_rows(_scale_bilinear<3, uint8_t>, src_ptr, w_ptr, src_width, src_height, p_width, p_height);
 							break;
 						case 4:
-							_scale_bilinear<4, uint8_t>(src_ptr, w_ptr, src_width, src_height, p_width, p_height);
+							_process_image_rows(_scale_bilinear<4, uint8_t>, src_ptr, w_ptr, src_width, src_height, p_width, p_height);
 							break;
 					}
 				} else if (format >= FORMAT_RF && format <= FORMAT_RGBAF) {
 					switch (get_format_pixel_size(format)) {
 						case 4:
-							_scale_bilinear<1, float>(src_ptr, w_ptr, src_width, src_height, p_width, p_height);
+							_process_image_rows(_scale_bilinear<1, float>, src_ptr, w_ptr, src_width, src_height, p_width, p_height);
 							break;
 						case 8:
-							_scale_bilinear<2, float>(src_ptr, w_ptr, src_width, src_height, p_width, p_height);
+							_process_image_rows(_scale_bilinear<2, float>, src_ptr, w_ptr, src_width, src_height, p_width, p_height);
 							break;
 						case 12:
-							_scale_bilinear<3, float>(src_ptr, w_ptr, src_width, src_height, p_width, p_height);
+							_process_image_rows(_scale_bilinear<3, float>, src_ptr, w_ptr, src_width, src_height, p_width, p_height);
 							break;
 						case 16:
-							_scale_bilinear<4, float>(src_ptr, w_ptr, src_width, src_height, p_width, p_height);
+							_process_image_rows(_scale_bilinear<4, float>, src_ptr, w_ptr, src_width, src_height, p_width, p_height);
 							break;
 					}
 				} else if (format >= FORMAT_RH && format <= FORMAT_RGBAH) {
 					switch (get_format_pixel_size(format)) {
 						case 2:
-							_scale_bilinear<1, uint16_t>(src_ptr, w_ptr, src_width, src_height, p_width, p_height);
+							_process_image_rows(_scale_bilinear<1, uint16_t>, src_ptr, w_ptr, src_width, src_height, p_width, p_height);
 							break;
 						case 4:
-							_scale_bilinear<2, uint16_t>(src_ptr, w_ptr, src_width, src_height, p_width, p_height);
+							_process_image_rows(_scale_bilinear<2, uint16_t>, src_ptr, w_ptr, src_width, src_height, p_width, p_height);
 							break;
 						case 6:
-							_scale_bilinear<3, uint16_t>(src_ptr, w_ptr, src_width, src_height, p_width, p_height);
+							_process_image_rows(_scale_bilinear<3, uint16_t>, src_ptr, w_ptr, src_width, src_height, p_width, p_height);
 							break;
 						case 8:
-							_scale_bilinear<4, uint16_t>(src_ptr, w_ptr, src_width, src_height, p_width, p_height);
+							_process_image_rows(_scale_bilinear<4, uint16_t>, src_ptr, w_ptr, src_width, src_height, p_width, p_height);
 							break;
 					}
 				}
@@ -1226,46 +1280,46 @@ void Image::resize(int p_width, int p_height, Interpolation p_interpolation) {
 			if (format >= FORMAT_L8 && format <= FORMAT_RGBA8) {
 				switch (get_format_pixel_size(format)) {
 					case 1:
-						_scale_cubic<1, uint8_t>(r_ptr, w_ptr, width, height, p_width, p_height);
+						_process_image_rows(_scale_cubic<1, uint8_t>, r_ptr, w_ptr, width, height, p_width, p_height);
 						break;
 					case 2:
-						_scale_cubic<2, uint8_t>(r_ptr, w_ptr, width, height, p_width, p_height);
+						_process_image_rows(_scale_cubic<2, uint8_t>, r_ptr, w_ptr, width, height, p_width, p_height);
 						break;
 					case 3:
-						_scale_cubic<3, uint8_t>(r_ptr, w_ptr, width, height, p_width, p_height);
+						_process_image_rows(_scale_cubic<3, uint8_t>, r_ptr, w_ptr, width, height, p_width, p_height);
 						break;
 					case 4:
-						_scale_cubic<4, uint8_t>(r_ptr, w_ptr, width, height, p_width, p_height);
+						_process_image_rows(_scale_cubic<4, uint8_t>, r_ptr, w_ptr, width, height, p_width, p_height);
 						break;
 				}
 			} else if (format >= FORMAT_RF && format <= FORMAT_RGBAF) {
 				switch (get_format_pixel_size(format)) {
 					case 4:
-						_scale_cubic<1, float>(r_ptr, w_ptr, width, height, p_width, p_height);
+						_process_image_rows(_scale_cubic<1, float>, r_ptr, w_ptr, width, height, p_width, p_height);
 						break;
 					case 8:
-						_scale_cubic<2, float>(r_ptr, w_ptr, width, height, p_width, p_height);
+						_process_image_rows(_scale_cubic<2, float>, r_ptr, w_ptr, width, height, p_width, p_height);
 						break;
 					case 12:
-						_scale_cubic<3, float>(r_ptr, w_ptr, width, height, p_width, p_height);
+						_process_image_rows(_scale_cubic<3, float>, r_ptr, w_ptr, width, height, p_width, p_height);
 						break;
 					case 16:
-						_scale_cubic<4, float>(r_ptr, w_ptr, width, height, p_width, p_height);
+						_process_image_rows(_scale_cubic<4, float>, r_ptr, w_ptr, width, height, p_width, p_height);
 						break;
 				}
 			} else if (format >= FORMAT_RH && format <= FORMAT_RGBAH) {
 				switch (get_format_pixel_size(format)) {
 					case 2:
-						_scale_cubic<1, uint16_t>(r_ptr, w_ptr, width, height, p_width, p_height);
+						_process_image_rows(_scale_cubic<1, uint16_t>, r_ptr, w_ptr, width, height, p_width, p_height);
 						break;
 					case 4:
-						_scale_cubic<2, uint16_t>(r_ptr, w_ptr, width, height, p_width, p_height);
+						_process_image_rows(_scale_cubic<2, uint16_t>, r_ptr, w_ptr, width, height, p_width, p_height);
 						break;
 					case 6:
-						_scale_cubic<3, uint16_t>(r_ptr, w_ptr, width, height, p_width, p_height);
+						_process_image_rows(_scale_cubic<3, uint16_t>, r_ptr, w_ptr, width, height, p_width, p_height);
 						break;
 					case 8:
-						_scale_cubic<4, uint16_t>(r_ptr, w_ptr, width, height, p_width, p_height);
+						_process_image_rows(_scale_cubic<4, uint16_t>, r_ptr, w_ptr, width, height, p_width, p_height);
 						break;
 				}
 			}
@@ -1667,18 +1721,18 @@ bool Image::_can_modify(Format p_format) const {
 template <class Component, int CC, bool renormalize,
 		void (*average_func)(Component &, const Component &, const Component &, const Component &, const Component &),
 		void (*renormalize_func)(Component *)>
-static void _generate_po2_mipmap(const Component *p_src, Component *p_dst, uint32_t p_width, uint32_t p_height) {
-	//fast power of 2 mipmap generation
-	uint32_t dst_w = MAX(p_width >> 1, 1u);
-	uint32_t dst_h = MAX(p_height >> 1, 1u);
+static void _generate_po2_mipmap_rows(const uint8_t *__restrict p_src, uint8_t *__restrict p_dst, uint32_t p_width, uint32_t p_height, uint32_t p_dst_width, uint32_t p_dst_height, uint32_t p_dst_row_from, uint32_t p_dst_row_to) {
+	const Component *src = reinterpret_cast<const Component *>(p_src);
+	Component *dst = reinterpret_cast<Component *>(p_dst);
+	uint32_t dst_w = p_dst_width;
 
 	int right_step = (p_width == 1) ? 0 : CC;
 	int down_step = (p_height == 1) ? 0 : (p_width * CC);
 
-	for (uint32_t i = 0; i < dst_h; i++) {
-		const Component *rup_ptr = &p_src[i * 2 * down_step];
+	for (uint32_t i = p_dst_row_from; i < p_dst_row_to; i++) {
+		const Component *rup_ptr = &src[i * 2 * down_step];
 		const Component *rdown_ptr = rup_ptr + down_step;
-		Component *dst_ptr = &p_dst[i * dst_w * CC];
+		Component *dst_ptr = &dst[i * dst_w * CC];
 		uint32_t count = dst_w;
 
 		while (count) {
@@ -1698,6 +1752,17 @@ static void _generate_po2_mipmap(const Component *p_src, Component *p_dst, uint3
 	}
 }
 
+template <class Component, int CC, bool renormalize,
+		void (*average_func)(Component &, const Component &, const Component &, const Component &, const Component &),
+		void (*renormalize_func)(Component *)>
+static void _generate_po2_mipmap(const Component *p_src, Component *p_dst, uint32_t p_width, uint32_t p_height) {
+	//fast power of 2 mipmap generation
+	uint32_t dst_w = MAX(p_width >> 1, 1u);
+	uint32_t dst_h = MAX(p_height >> 1, 1u);
+
+	_process_image_rows(_generate_po2_mipmap_rows<Component, CC, renormalize, average_func, renormalize_func>, reinterpret_cast<const uint8_t *>(p_src), reinterpret_cast<uint8_t *>(p_dst), p_width, p_height, dst_w, dst_h);
+}
+
 void Image::shrink_x2() {
 	ERR_FAIL_COND(data.size() == 0);
 
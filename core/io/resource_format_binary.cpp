@@ -33,6 +33,7 @@
 #include "core/config/project_settings.h"
 #include "core/io/dir_access.h"
 #include "core/io/file_access_compressed.h"
+#include "core/io/file_access_memory.h"
 #include "core/io/image.h"
 #include "core/io/marshalls.h"
 #include "core/io/missing_resource.h"
@@ -1186,6 +1187,19 @@ Ref<Resource> ResourceFormatLoaderBinary::load(const String &p_path, const Strin
 
 	ERR_FAIL_COND_V_MSG(err != OK, Ref<Resource>(), "Cannot open file '" + p_path + "'.");
 
+	// Reading field by field from a mapping of the file is much faster than through the file backend.
+	// The mapped pages are backed by the file and not counted by Memory::get_mem_usage().
+	Ref<FileAccess> mapped_file;
+	const uint8_t *mapped_data = f->map_read_only();
+	if (mapped_data) {
+		Ref<FileAccessMemory> fm;
+		fm.instantiate();
+		if (fm->open_custom(mapped_data, f->get_length()) == OK) {
+			mapped_file = f; // Keeps the mapping alive while loading.
+			f = fm;
+		}
+	}
+
 	ResourceLoaderBinary loader;
 	loader.cache_mode = p_cache_mode;
 	loader.use_sub_threads = p_use_sub_threads;
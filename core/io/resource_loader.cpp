@@ -429,6 +429,23 @@ Ref<Resource> ResourceLoader::load(const String &p_path, const String &p_type_hi
 Ref<ResourceLoader::LoadToken> ResourceLoader::_load_start(const String &p_path, const String &p_type_hint, LoadThreadMode p_thread_mode, ResourceFormatLoader::CacheMode p_cache_mode) {
 	String local_path = _validate_local_path(p_path);
 
+	if (p_cache_mode != ResourceFormatLoader::CACHE_MODE_IGNORE) {
+		// Fast path for resources already being loaded, so remapping can be skipped.
+		MutexLock thread_load_lock(thread_load_mutex);
+		HashMap<String, ThreadLoadTask>::Iterator E = thread_load_tasks.find(local_path);
+		if (E) {
+			Ref<LoadToken> existing_token = Ref<LoadToken>(E->value.load_token);
+			if (existing_token.is_valid()) {
+				return existing_token;
+			}
+		}
+	}
+
+	// Remapping may hit the filesystem, so do it before taking the lock shared by all loads.
+	// Otherwise, the dependencies of a resource loaded with sub-threads would all start one after another.
+	bool xl_remapped = false;
+	const String remapped_path = _path_remap(local_path, &xl_remapped);
+
 	Ref<LoadToken> load_token;
 	bool must_not_register = false;
 	ThreadLoadTask unregistered_load_task; // Once set, must be valid up to the call to do the load.
@@ -457,7 +474,8 @@ Ref<ResourceLoader::LoadToken> ResourceLoader::_load_start(const String &p_path,
 		{
 			ThreadLoadTask load_task;
 
-			load_task.remapped_path = _path_remap(local_path, &load_task.xl_remapped);
+			load_task.remapped_path = remapped_path;
+			load_task.xl_remapped = xl_remapped;
 			load_task.load_token = load_token.ptr();
 			load_task.local_path = local_path;
 			load_task.type_hint = p_type_hint;
@@ -492,6 +510,14 @@ Ref<ResourceLoader::LoadToken> ResourceLoader::_load_start(const String &p_path,
 		if (run_on_current_thread) {
 			load_task_ptr->thread_id = Thread::get_caller_id();
 		} else {
+			if (load_nesting > 0 && load_paths_stack->size()) {
+				// A dependency handed to the pool by a resource being loaded. Track it as
+				// a sub-task of the latter so it's accounted for in its progress.
+				HashMap<String, ThreadLoadTask>::Iterator E = thread_load_tasks.find(load_paths_stack->get(load_paths_stack->size() - 1));
+				if (E) {
+					E->value.sub_tasks.insert(local_path);
+				}
+			}
 			load_task_ptr->task_id = WorkerThreadPool::get_singleton()->add_native_task(&ResourceLoader::_thread_load_function, load_task_ptr);
 		}
 	}
@@ -52,6 +52,7 @@
 // and pairable_mask is either 0 if static, or set to all if non static
 
 #include "bvh_tree.h"
+#include "core/object/worker_thread_pool.h"
 #include "core/os/mutex.h"
 
 #define BVHTREE_CLASS BVH_Tree<T, NUM_TREES, 2, MAX_ITEMS, USER_PAIR_TEST_FUNCTION, USER_CULL_TEST_FUNCTION, USE_PAIRS, BOUNDS, POINT>
@@ -88,6 +89,13 @@ public:
 		tree.params_set_pairing_expansion(p_value);
 	}
 
+	// Find pairing changes on the WorkerThreadPool when many items changed at once.
+	// Callbacks are still sent from the calling thread, in the same order regardless of thread count.
+	void params_set_parallel_pairing(bool p_enable) {
+		BVH_LOCKED_FUNCTION
+		_parallel_pairing = p_enable;
+	}
+
 	void set_pair_callback(PairCallback p_callback, void *p_userdata) {
 		BVH_LOCKED_FUNCTION
 		pair_callback = p_callback;
@@ -435,6 +443,11 @@ private:
 			return;
 		}
 
+		if (_parallel_pairing) {
+			_check_for_collisions_parallel(p_full_check);
+			return;
+		}
+
 		BOUNDS bb;
 
 		typename BVHTREE_CLASS::CullParams params;
@@ -480,6 +493,114 @@ private:
 		_reset();
 	}
 
+	// Two pass version of the above. The expensive part (tree culls and overlap tests) only reads the tree,
+	// so it runs for all changed items in parallel, then the results are applied in changed item order.
+	void _check_for_collisions_parallel(bool p_full_check) {
+		uint32_t changed_count = changed_items.size();
+		if (pairing_changes.size() < changed_count) {
+			pairing_changes.resize(changed_count);
+		}
+
+		if (changed_count >= PARALLEL_PAIRING_MIN_ITEMS && WorkerThreadPool::get_singleton()) {
+			WorkerThreadPool::GroupID group_task = WorkerThreadPool::get_singleton()->add_template_group_task(this, &BVH_Manager::_gather_pairing_changes, p_full_check, changed_count, -1, true, SNAME("BVHPairing"));
+			WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group_task);
+		} else {
+			for (uint32_t i = 0; i < changed_count; i++) {
+				_gather_pairing_changes(i, p_full_check);
+			}
+		}
+
+		for (uint32_t i = 0; i < changed_count; i++) {
+			BVHHandle h = changed_items[i];
+			const PairingChanges &changes = pairing_changes[i];
+
+			for (const BVHHandle &h_to : changes.leavers) {
+				// If both items changed, both will have found the pair leaving.
+				if (tree._pairs[h.id()].contains_pair_to(h_to)) {
+					_unpair(h, h_to);
+				}
+			}
+
+			for (const uint32_t ref_id : changes.enterers) {
+				BVHHandle h_collidee;
+				h_collidee.set_id(ref_id);
+
+				// _collide() checks again whether the pair exists, as an item changed earlier may have added it.
+				_collide(h, h_collidee);
+			}
+		}
+
+		_reset();
+	}
+
+	// Only reads the tree, so it is safe to call for several changed items at the same time.
+	void _gather_pairing_changes(uint32_t p_index, bool p_full_check) {
+		const BVHHandle h = changed_items[p_index];
+		PairingChanges &changes = pairing_changes[p_index];
+		const typename BVHTREE_CLASS::ItemPairs &pairs_from = tree._pairs[h.id()];
+
+		// use the expanded aabb for pairing
+		BVHABB_CLASS abb;
+		abb.from(pairs_from.expanded_aabb);
+
+		// find all the existing paired aabbs that are no longer paired
+		changes.leavers.clear();
+		for (unsigned int n = 0; n < pairs_from.extended_pairs.size(); n++) {
+			BVHHandle h_to = pairs_from.extended_pairs[n].handle;
+			if (_is_pair_leaving(abb, h, h_to, p_full_check)) {
+				changes.leavers.push_back(h_to);
+			}
+		}
+
+		typename BVHTREE_CLASS::CullParams params;
+
+		params.result_count_overall = 0;
+		params.result_max = INT_MAX;
+		params.result_array = nullptr;
+		params.subindex_array = nullptr;
+		params.hits = &changes.enterers;
+
+		tree.item_fill_cullparams(h, params);
+		params.abb = abb;
+		tree.cull_aabb(params, false);
+
+		// Filter out what _collide() would reject anyway, to keep the serial part short.
+		const typename BVHTREE_CLASS::ItemExtra &ex_from = _get_extra(h);
+		uint32_t enterer_count = 0;
+		for (const uint32_t ref_id : changes.enterers) {
+			// don't collide against ourself
+			if (ref_id == h.id()) {
+				continue;
+			}
+
+			BVHHandle h_to;
+			h_to.set_id(ref_id);
+			const typename BVHTREE_CLASS::ItemExtra &ex_to = _get_extra(h_to);
+
+			// user collision callback, which is symmetrical
+			if (!USER_PAIR_TEST_FUNCTION::user_pair_check(ex_from.userdata, ex_to.userdata)) {
+				continue;
+			}
+
+			// if the userdata is the same, no collisions should occur
+			if ((ex_from.userdata == ex_to.userdata) && ex_from.userdata) {
+				continue;
+			}
+
+			// An existing pair can only be broken this tick by the other item, if it's on the changed list too.
+			// We overlap it, so we won't break it ourselves, unless masks changed (full check).
+			if (!p_full_check && ex_to.last_updated_tick != _tick) {
+				const typename BVHTREE_CLASS::ItemPairs &pairs_to = tree._pairs[ref_id];
+				if (pairs_from.num_pairs <= pairs_to.num_pairs ? pairs_from.contains_pair_to(h_to) : pairs_to.contains_pair_to(h)) {
+					continue;
+				}
+			}
+
+			changes.enterers[enterer_count++] = ref_id;
+		}
+		changes.enterers.resize(enterer_count);
+	}
+
 public:
 	void item_get_AABB(BVHHandle p_handle, BOUNDS &r_aabb) {
 		DEV_ASSERT(!p_handle.is_invalid());
@@ -540,8 +661,8 @@ private:
 		return p_pair_data;
 	}
 
-	// returns true if unpair
-	bool _find_leavers_process_pair(typename BVHTREE_CLASS::ItemPairs &p_pairs_from, const BVHABB_CLASS &p_abb_from, BVHHandle p_from, BVHHandle p_to, bool p_full_check) {
+	// returns true if the pair should be removed
+	bool _is_pair_leaving(const BVHABB_CLASS &p_abb_from, BVHHandle p_from, BVHHandle p_to, bool p_full_check) {
 		BVHABB_CLASS abb_to;
 		tree.item_get_ABB(p_to, abb_to);
 
@@ -568,6 +689,15 @@ private:
 			}
 		}
 
+		return true;
+	}
+
+	// returns true if unpair
+	bool _find_leavers_process_pair(typename BVHTREE_CLASS::ItemPairs &p_pairs_from, const BVHABB_CLASS &p_abb_from, BVHHandle p_from, BVHHandle p_to, bool p_full_check) {
+		if (!_is_pair_leaving(p_abb_from, p_from, p_to, p_full_check)) {
+			return false;
+		}
+
 		_unpair(p_from, p_to);
 		return true;
 	}
@@ -773,6 +903,20 @@ private:
 	LocalVector<BVHHandle, uint32_t, true> changed_items;
 	uint32_t _tick = 1; // Start from 1 so items with 0 indicate never updated.
 
+	// Pairing changes found for each changed item, when pairing in parallel.
+	// Kept between ticks to reuse the allocations.
+	struct PairingChanges {
+		LocalVector<BVHHandle, uint32_t, true> leavers;
+		LocalVector<uint32_t, uint32_t, true> enterers;
+	};
+	LocalVector<PairingChanges> pairing_changes;
+	bool _parallel_pairing = false;
+
+	enum {
+		// Below this, the cost of dispatching to threads outweighs the gains.
+		PARALLEL_PAIRING_MIN_ITEMS = 64,
+	};
+
 	class BVHLockedFunction {
 	public:
 		BVHLockedFunction(Mutex *p_mutex, bool p_thread_safe) {
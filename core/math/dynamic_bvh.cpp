@@ -386,6 +386,33 @@ bool DynamicBVH::update(const ID &p_id, const AABB &p_box) {
 	return true;
 }
 
+void DynamicBVH::refit(const ID *p_ids, const AABB *p_boxes, uint32_t p_count) {
+	for (uint32_t i = 0; i < p_count; i++) {
+		ERR_CONTINUE(!p_ids[i].is_valid());
+		Node *leaf = p_ids[i].node;
+
+		Volume volume;
+		volume.min = p_boxes[i].position;
+		volume.max = p_boxes[i].position + p_boxes[i].size;
+
+		if (!leaf->volume.intersects(volume)) {
+			// Moved too far to keep its place in the tree, reinsert it.
+			update(p_ids[i], p_boxes[i]);
+			continue;
+		}
+
+		// Keep the tree as is and only fix the bounds of the ancestors.
+		leaf->volume = volume;
+		for (Node *node = leaf->parent; node; node = node->parent) {
+			const Volume merged = node->children[0]->volume.merge(node->children[1]->volume);
+			if (!merged.is_not_equal_to(node->volume)) {
+				break;
+			}
+			node->volume = merged;
+		}
+	}
+}
+
 void DynamicBVH::remove(const ID &p_id) {
 	ERR_FAIL_COND(!p_id.is_valid());
 	Node *leaf = p_id.node;
@@ -293,6 +293,7 @@ public:
 	void optimize_incremental(int passes);
 	ID insert(const AABB &p_box, void *p_userdata);
 	bool update(const ID &p_id, const AABB &p_box);
+	void refit(const ID *p_ids, const AABB *p_boxes, uint32_t p_count);
 	void remove(const ID &p_id);
 	void get_elements(List<ID> *r_elements);
 
@@ -35,6 +35,7 @@
 #include "core/object/class_db.h"
 #include "core/object/ref_counted.h"
 #include "core/os/os.h"
+#include "core/variant/variant_internal.h"
 #include "core/variant/variant_parser.h"
 
 Error Expression::_get_token(Token &r_token) {
@@ -1239,232 +1240,438 @@ bool Expression::_compile_expression() {
 	return false;
 }
 
-bool Expression::_execute(const Array &p_inputs, Object *p_instance, Expression::ENode *p_node, Variant &r_ret, bool p_const_calls_only, String &r_error_str) {
+int Expression::_add_constant(const Variant &p_value) {
+	int index = constants.size();
+	constants.push_back(p_value);
+	return (index << ADDRESS_TYPE_BITS) | ADDRESS_CONSTANT;
+}
+
+int Expression::_add_name(const StringName &p_name) {
+	int64_t index = names.find(p_name);
+	if (index == -1) {
+		index = names.size();
+		names.push_back(p_name);
+	}
+	return index;
+}
+
+// Values shared by reference can't be folded into constants, as each execution must return a new one.
+static bool _is_foldable(const Variant &p_value) {
+	return p_value.get_type() != Variant::ARRAY && p_value.get_type() != Variant::DICTIONARY && p_value.get_type() != Variant::OBJECT;
+}
+
+int Expression::_compile_node(ENode *p_node) {
 	switch (p_node->type) {
 		case Expression::ENode::TYPE_INPUT: {
 			const Expression::InputNode *in = static_cast<const Expression::InputNode *>(p_node);
-			if (in->index < 0 || in->index >= p_inputs.size()) {
-				r_error_str = vformat(RTR("Invalid input %d (not passed) in expression"), in->index);
-				return true;
-			}
-			r_ret = p_inputs[in->index];
-		} break;
+			used_inputs.push_back(in->index);
+			return (in->index << ADDRESS_TYPE_BITS) | ADDRESS_INPUT;
+		}
 		case Expression::ENode::TYPE_CONSTANT: {
 			const Expression::ConstantNode *c = static_cast<const Expression::ConstantNode *>(p_node);
-			r_ret = c->value;
-
-		} break;
+			return _add_constant(c->value);
+		}
 		case Expression::ENode::TYPE_SELF: {
-			if (!p_instance) {
-				r_error_str = RTR("self can't be used because instance is null (not passed)");
-				return true;
-			}
-			r_ret = p_instance;
-		} break;
+			int dst = register_count++;
+			code.push_back(OPCODE_SELF);
+			code.push_back(dst);
+			return (dst << ADDRESS_TYPE_BITS) | ADDRESS_REGISTER;
+		}
 		case Expression::ENode::TYPE_OPERATOR: {
 			const Expression::OperatorNode *op = static_cast<const Expression::OperatorNode *>(p_node);
 
-			Variant a;
-			bool ret = _execute(p_inputs, p_instance, op->nodes[0], a, p_const_calls_only, r_error_str);
-			if (ret) {
-				return true;
-			}
-
-			Variant b;
+			int a = _compile_node(op->nodes[0]);
+			int b = op->nodes[1] ? _compile_node(op->nodes[1]) : _add_constant(Variant());
 
-			if (op->nodes[1]) {
-				ret = _execute(p_inputs, p_instance, op->nodes[1], b, p_const_calls_only, r_error_str);
-				if (ret) {
-					return true;
+			if ((a & ADDRESS_TYPE_MASK) == ADDRESS_CONSTANT && (b & ADDRESS_TYPE_MASK) == ADDRESS_CONSTANT) {
+				Variant result;
+				bool valid = true;
+				Variant::evaluate(op->op, constants[a >> ADDRESS_TYPE_BITS], constants[b >> ADDRESS_TYPE_BITS], result, valid);
+				if (valid && _is_foldable(result)) {
+					return _add_constant(result);
 				}
 			}
 
-			bool valid = true;
-			Variant::evaluate(op->op, a, b, r_ret, valid);
-			if (!valid) {
-				r_error_str = vformat(RTR("Invalid operands to operator %s, %s and %s."), Variant::get_operator_name(op->op), Variant::get_type_name(a.get_type()), Variant::get_type_name(b.get_type()));
-				return true;
-			}
-
-		} break;
+			int dst = register_count++;
+			code.push_back(OPCODE_OPERATOR);
+			code.push_back(dst);
+			code.push_back(op->op);
+			code.push_back(a);
+			code.push_back(b);
+			return (dst << ADDRESS_TYPE_BITS) | ADDRESS_REGISTER;
+		}
 		case Expression::ENode::TYPE_INDEX: {
 			const Expression::IndexNode *index = static_cast<const Expression::IndexNode *>(p_node);
 
-			Variant base;
-			bool ret = _execute(p_inputs, p_instance, index->base, base, p_const_calls_only, r_error_str);
-			if (ret) {
-				return true;
-			}
-
-			Variant idx;
+			int base = _compile_node(index->base);
+			int idx = _compile_node(index->index);
 
-			ret = _execute(p_inputs, p_instance, index->index, idx, p_const_calls_only, r_error_str);
-			if (ret) {
-				return true;
-			}
-
-			bool valid;
-			r_ret = base.get(idx, &valid);
-			if (!valid) {
-				r_error_str = vformat(RTR("Invalid index of type %s for base type %s"), Variant::get_type_name(idx.get_type()), Variant::get_type_name(base.get_type()));
-				return true;
+			if ((base & ADDRESS_TYPE_MASK) == ADDRESS_CONSTANT && (idx & ADDRESS_TYPE_MASK) == ADDRESS_CONSTANT) {
+				bool valid = false;
+				Variant result = constants[base >> ADDRESS_TYPE_BITS].get(constants[idx >> ADDRESS_TYPE_BITS], &valid);
+				if (valid && _is_foldable(result)) {
+					return _add_constant(result);
+				}
 			}
 
-		} break;
+			int dst = register_count++;
+			code.push_back(OPCODE_INDEX);
+			code.push_back(dst);
+			code.push_back(base);
+			code.push_back(idx);
+			return (dst << ADDRESS_TYPE_BITS) | ADDRESS_REGISTER;
+		}
 		case Expression::ENode::TYPE_NAMED_INDEX: {
 			const Expression::NamedIndexNode *index = static_cast<const Expression::NamedIndexNode *>(p_node);
 
-			Variant base;
-			bool ret = _execute(p_inputs, p_instance, index->base, base, p_const_calls_only, r_error_str);
-			if (ret) {
-				return true;
-			}
+			int base = _compile_node(index->base);
 
-			bool valid;
-			r_ret = base.get_named(index->name, valid);
-			if (!valid) {
-				r_error_str = vformat(RTR("Invalid named index '%s' for base type %s"), String(index->name), Variant::get_type_name(base.get_type()));
-				return true;
+			if ((base & ADDRESS_TYPE_MASK) == ADDRESS_CONSTANT) {
+				bool valid = false;
+				Variant result = constants[base >> ADDRESS_TYPE_BITS].get_named(index->name, valid);
+				if (valid && _is_foldable(result)) {
+					return _add_constant(result);
+				}
 			}
 
-		} break;
+			int dst = register_count++;
+			code.push_back(OPCODE_NAMED_INDEX);
+			code.push_back(dst);
+			code.push_back(base);
+			code.push_back(_add_name(index->name));
+			return (dst << ADDRESS_TYPE_BITS) | ADDRESS_REGISTER;
+		}
 		case Expression::ENode::TYPE_ARRAY: {
 			const Expression::ArrayNode *array = static_cast<const Expression::ArrayNode *>(p_node);
 
-			Array arr;
-			arr.resize(array->array.size());
+			LocalVector<int> elements;
 			for (int i = 0; i < array->array.size(); i++) {
-				Variant value;
-				bool ret = _execute(p_inputs, p_instance, array->array[i], value, p_const_calls_only, r_error_str);
-
-				if (ret) {
-					return true;
-				}
-				arr[i] = value;
+				elements.push_back(_compile_node(array->array[i]));
 			}
 
-			r_ret = arr;
-
-		} break;
+			int dst = register_count++;
+			code.push_back(OPCODE_ARRAY);
+			code.push_back(dst);
+			code.push_back(elements.size());
+			for (int element : elements) {
+				code.push_back(element);
+			}
+			return (dst << ADDRESS_TYPE_BITS) | ADDRESS_REGISTER;
+		}
 		case Expression::ENode::TYPE_DICTIONARY: {
 			const Expression::DictionaryNode *dictionary = static_cast<const Expression::DictionaryNode *>(p_node);
 
-			Dictionary d;
-			for (int i = 0; i < dictionary->dict.size(); i += 2) {
-				Variant key;
-				bool ret = _execute(p_inputs, p_instance, dictionary->dict[i + 0], key, p_const_calls_only, r_error_str);
-
-				if (ret) {
-					return true;
-				}
-
-				Variant value;
-				ret = _execute(p_inputs, p_instance, dictionary->dict[i + 1], value, p_const_calls_only, r_error_str);
-				if (ret) {
-					return true;
-				}
-
-				d[key] = value;
+			LocalVector<int> elements;
+			for (int i = 0; i < dictionary->dict.size(); i++) {
+				elements.push_back(_compile_node(dictionary->dict[i]));
 			}
 
-			r_ret = d;
-		} break;
+			int dst = register_count++;
+			code.push_back(OPCODE_DICTIONARY);
+			code.push_back(dst);
+			code.push_back(elements.size() / 2);
+			for (int element : elements) {
+				code.push_back(element);
+			}
+			return (dst << ADDRESS_TYPE_BITS) | ADDRESS_REGISTER;
+		}
 		case Expression::ENode::TYPE_CONSTRUCTOR: {
 			const Expression::ConstructorNode *constructor = static_cast<const Expression::ConstructorNode *>(p_node);
 
-			Vector<Variant> arr;
-			Vector<const Variant *> argp;
-			arr.resize(constructor->arguments.size());
-			argp.resize(constructor->arguments.size());
-
+			LocalVector<int> arguments;
+			bool all_constant = true;
 			for (int i = 0; i < constructor->arguments.size(); i++) {
-				Variant value;
-				bool ret = _execute(p_inputs, p_instance, constructor->arguments[i], value, p_const_calls_only, r_error_str);
+				int argument = _compile_node(constructor->arguments[i]);
+				all_constant = all_constant && (argument & ADDRESS_TYPE_MASK) == ADDRESS_CONSTANT;
+				arguments.push_back(argument);
+			}
 
-				if (ret) {
-					return true;
+			if (all_constant && constructor->data_type != Variant::ARRAY && constructor->data_type != Variant::DICTIONARY && constructor->data_type != Variant::OBJECT) {
+				LocalVector<const Variant *> argp;
+				for (int argument : arguments) {
+					argp.push_back(&constants[argument >> ADDRESS_TYPE_BITS]);
+				}
+				Variant result;
+				Callable::CallError ce;
+				Variant::construct(constructor->data_type, result, argp.ptr(), argp.size(), ce);
+				if (ce.error == Callable::CallError::CALL_OK && _is_foldable(result)) {
+					return _add_constant(result);
 				}
-				arr.write[i] = value;
-				argp.write[i] = &arr[i];
 			}
 
-			Callable::CallError ce;
-			Variant::construct(constructor->data_type, r_ret, (const Variant **)argp.ptr(), argp.size(), ce);
-
-			if (ce.error != Callable::CallError::CALL_OK) {
-				r_error_str = vformat(RTR("Invalid arguments to construct '%s'"), Variant::get_type_name(constructor->data_type));
-				return true;
+			max_argument_count = MAX(max_argument_count, (int)arguments.size());
+			int dst = register_count++;
+			code.push_back(OPCODE_CONSTRUCT);
+			code.push_back(dst);
+			code.push_back(constructor->data_type);
+			code.push_back(arguments.size());
+			for (int argument : arguments) {
+				code.push_back(argument);
 			}
-
-		} break;
+			return (dst << ADDRESS_TYPE_BITS) | ADDRESS_REGISTER;
+		}
 		case Expression::ENode::TYPE_BUILTIN_FUNC: {
 			const Expression::BuiltinFuncNode *bifunc = static_cast<const Expression::BuiltinFuncNode *>(p_node);
 
-			Vector<Variant> arr;
-			Vector<const Variant *> argp;
-			arr.resize(bifunc->arguments.size());
-			argp.resize(bifunc->arguments.size());
-
+			LocalVector<int> arguments;
 			for (int i = 0; i < bifunc->arguments.size(); i++) {
-				Variant value;
-				bool ret = _execute(p_inputs, p_instance, bifunc->arguments[i], value, p_const_calls_only, r_error_str);
-				if (ret) {
-					return true;
-				}
-				arr.write[i] = value;
-				argp.write[i] = &arr[i];
+				arguments.push_back(_compile_node(bifunc->arguments[i]));
 			}
 
-			r_ret = Variant(); //may not return anything
-			Callable::CallError ce;
-			Variant::call_utility_function(bifunc->func, &r_ret, (const Variant **)argp.ptr(), argp.size(), ce);
-			if (ce.error != Callable::CallError::CALL_OK) {
-				r_error_str = "Builtin call failed: " + Variant::get_call_error_text(bifunc->func, (const Variant **)argp.ptr(), argp.size(), ce);
-				return true;
+			max_argument_count = MAX(max_argument_count, (int)arguments.size());
+			int dst = register_count++;
+			code.push_back(OPCODE_BUILTIN_FUNC);
+			code.push_back(dst);
+			code.push_back(_add_name(bifunc->func));
+			code.push_back(arguments.size());
+			for (int argument : arguments) {
+				code.push_back(argument);
 			}
-
-		} break;
+			return (dst << ADDRESS_TYPE_BITS) | ADDRESS_REGISTER;
+		}
 		case Expression::ENode::TYPE_CALL: {
 			const Expression::CallNode *call = static_cast<const Expression::CallNode *>(p_node);
 
-			Variant base;
-			bool ret = _execute(p_inputs, p_instance, call->base, base, p_const_calls_only, r_error_str);
+			int base = _compile_node(call->base);
+			LocalVector<int> arguments;
+			for (int i = 0; i < call->arguments.size(); i++) {
+				arguments.push_back(_compile_node(call->arguments[i]));
+			}
 
-			if (ret) {
-				return true;
+			max_argument_count = MAX(max_argument_count, (int)arguments.size());
+			int dst = register_count++;
+			code.push_back(OPCODE_CALL);
+			code.push_back(dst);
+			code.push_back(base);
+			code.push_back(_add_name(call->method));
+			code.push_back(call_caches.size());
+			call_caches.push_back(CallCache());
+			code.push_back(arguments.size());
+			for (int argument : arguments) {
+				code.push_back(argument);
 			}
+			return (dst << ADDRESS_TYPE_BITS) | ADDRESS_REGISTER;
+		}
+	}
+	return _add_constant(Variant());
+}
 
-			Vector<Variant> arr;
-			Vector<const Variant *> argp;
-			arr.resize(call->arguments.size());
-			argp.resize(call->arguments.size());
+void Expression::_compile() {
+	_clear_program();
+	result_address = _compile_node(root);
+}
 
-			for (int i = 0; i < call->arguments.size(); i++) {
-				Variant value;
-				ret = _execute(p_inputs, p_instance, call->arguments[i], value, p_const_calls_only, r_error_str);
+void Expression::_clear_program() {
+	code.clear();
+	constants.clear();
+	names.clear();
+	call_caches.clear();
+	used_inputs.clear();
+	register_count = 0;
+	max_argument_count = 0;
+	result_address = 0;
+}
 
-				if (ret) {
-					return true;
-				}
-				arr.write[i] = value;
-				argp.write[i] = &arr[i];
+// Division and modulo of integers, string formatting, and shifts, report invalid operands through the regular evaluator only.
+static _FORCE_INLINE_ bool _can_use_validated_operator(Variant::Operator p_op, Variant::Type p_type_a) {
+	switch (p_op) {
+		case Variant::OP_MODULE:
+			if (p_type_a == Variant::STRING || p_type_a == Variant::STRING_NAME) {
+				return false;
 			}
+			[[fallthrough]];
+		case Variant::OP_DIVIDE:
+			return p_type_a != Variant::INT && p_type_a != Variant::VECTOR2I && p_type_a != Variant::VECTOR3I && p_type_a != Variant::VECTOR4I;
+		case Variant::OP_SHIFT_LEFT:
+		case Variant::OP_SHIFT_RIGHT:
+		case Variant::OP_IN:
+			return false;
+		default:
+			return true;
+	}
+}
 
-			Callable::CallError ce;
-			if (p_const_calls_only) {
-				base.call_const(call->method, (const Variant **)argp.ptr(), argp.size(), r_ret, ce);
-			} else {
-				base.callp(call->method, (const Variant **)argp.ptr(), argp.size(), r_ret, ce);
-			}
+bool Expression::_execute(const Array &p_inputs, Object *p_instance, Variant &r_ret, bool p_const_calls_only, String &r_error_str) {
+	for (int input : used_inputs) {
+		if (input < 0 || input >= p_inputs.size()) {
+			r_error_str = vformat(RTR("Invalid input %d (not passed) in expression"), input);
+			return true;
+		}
+	}
 
-			if (ce.error != Callable::CallError::CALL_OK) {
-				r_error_str = vformat(RTR("On call to '%s':"), String(call->method));
-				return true;
-			}
+	Variant *registers = (Variant *)alloca(sizeof(Variant) * MAX(register_count, 1));
+	for (int i = 0; i < register_count; i++) {
+		memnew_placement(&registers[i], Variant);
+	}
+	const Variant **argptrs = (const Variant **)alloca(sizeof(Variant *) * MAX(max_argument_count, 1));
+
+#define GET_OPERAND(m_address) \
+	(((m_address) & ADDRESS_TYPE_MASK) == ADDRESS_REGISTER ? &registers[(m_address) >> ADDRESS_TYPE_BITS] : (((m_address) & ADDRESS_TYPE_MASK) == ADDRESS_CONSTANT ? &constants[(m_address) >> ADDRESS_TYPE_BITS] : &p_inputs[(m_address) >> ADDRESS_TYPE_BITS]))
+
+	bool failed = false;
+	uint32_t ip = 0;
+	while (ip < code.size() && !failed) {
+		Variant &dst = registers[code[ip + 1]];
+
+		switch (code[ip]) {
+			case OPCODE_SELF: {
+				if (!p_instance) {
+					r_error_str = RTR("self can't be used because instance is null (not passed)");
+					failed = true;
+					break;
+				}
+				dst = p_instance;
+				ip += 2;
+			} break;
+			case OPCODE_OPERATOR: {
+				Variant::Operator op = (Variant::Operator)code[ip + 2];
+				const Variant *a = GET_OPERAND(code[ip + 3]);
+				const Variant *b = GET_OPERAND(code[ip + 4]);
+
+				Variant::ValidatedOperatorEvaluator evaluator = _can_use_validated_operator(op, a->get_type()) ? Variant::get_validated_operator_evaluator(op, a->get_type(), b->get_type()) : nullptr;
+				if (evaluator) {
+					Variant::Type return_type = Variant::get_operator_return_type(op, a->get_type(), b->get_type());
+					if (dst.get_type() != return_type) {
+						VariantInternal::initialize(&dst, return_type);
+					}
+					evaluator(a, b, &dst);
+				} else {
+					bool valid = true;
+					Variant::evaluate(op, *a, *b, dst, valid);
+					if (!valid) {
+						r_error_str = vformat(RTR("Invalid operands to operator %s, %s and %s."), Variant::get_operator_name(op), Variant::get_type_name(a->get_type()), Variant::get_type_name(b->get_type()));
+						failed = true;
+						break;
+					}
+				}
+				ip += 5;
+			} break;
+			case OPCODE_INDEX: {
+				const Variant *base = GET_OPERAND(code[ip + 2]);
+				const Variant *idx = GET_OPERAND(code[ip + 3]);
+
+				bool valid;
+				dst = base->get(*idx, &valid);
+				if (!valid) {
+					r_error_str = vformat(RTR("Invalid index of type %s for base type %s"), Variant::get_type_name(idx->get_type()), Variant::get_type_name(base->get_type()));
+					failed = true;
+					break;
+				}
+				ip += 4;
+			} break;
+			case OPCODE_NAMED_INDEX: {
+				const Variant *base = GET_OPERAND(code[ip + 2]);
+				const StringName &name = names[code[ip + 3]];
+
+				bool valid;
+				dst = base->get_named(name, valid);
+				if (!valid) {
+					r_error_str = vformat(RTR("Invalid named index '%s' for base type %s"), String(name), Variant::get_type_name(base->get_type()));
+					failed = true;
+					break;
+				}
+				ip += 4;
+			} break;
+			case OPCODE_ARRAY: {
+				int count = code[ip + 2];
+				Array arr;
+				arr.resize(count);
+				for (int i = 0; i < count; i++) {
+					arr[i] = *GET_OPERAND(code[ip + 3 + i]);
+				}
+				dst = arr;
+				ip += 3 + count;
+			} break;
+			case OPCODE_DICTIONARY: {
+				int count = code[ip + 2];
+				Dictionary d;
+				for (int i = 0; i < count; i++) {
+					d[*GET_OPERAND(code[ip + 3 + i * 2])] = *GET_OPERAND(code[ip + 4 + i * 2]);
+				}
+				dst = d;
+				ip += 3 + count * 2;
+			} break;
+			case OPCODE_CONSTRUCT: {
+				Variant::Type type = (Variant::Type)code[ip + 2];
+				int argcount = code[ip + 3];
+				for (int i = 0; i < argcount; i++) {
+					argptrs[i] = GET_OPERAND(code[ip + 4 + i]);
+				}
+
+				Callable::CallError ce;
+				Variant::construct(type, dst, argptrs, argcount, ce);
+				if (ce.error != Callable::CallError::CALL_OK) {
+					r_error_str = vformat(RTR("Invalid arguments to construct '%s'"), Variant::get_type_name(type));
+					failed = true;
+					break;
+				}
+				ip += 4 + argcount;
+			} break;
+			case OPCODE_BUILTIN_FUNC: {
+				const StringName &func = names[code[ip + 2]];
+				int argcount = code[ip + 3];
+				for (int i = 0; i < argcount; i++) {
+					argptrs[i] = GET_OPERAND(code[ip + 4 + i]);
+				}
+
+				dst = Variant(); //may not return anything
+				Callable::CallError ce;
+				Variant::call_utility_function(func, &dst, argptrs, argcount, ce);
+				if (ce.error != Callable::CallError::CALL_OK) {
+					r_error_str = "Builtin call failed: " + Variant::get_call_error_text(func, argptrs, argcount, ce);
+					failed = true;
+					break;
+				}
+				ip += 4 + argcount;
+			} break;
+			case OPCODE_CALL: {
+				// The base is copied, as calls may modify it.
+				Variant base = *GET_OPERAND(code[ip + 2]);
+				const StringName &method = names[code[ip + 3]];
+				CallCache &cache = call_caches[code[ip + 4]];
+				int argcount = code[ip + 5];
+				for (int i = 0; i < argcount; i++) {
+					argptrs[i] = GET_OPERAND(code[ip + 6 + i]);
+				}
+
+				Callable::CallError ce;
+				if (base.get_type() != Variant::OBJECT) {
+					if (cache.type != base.get_type() || !cache.method) {
+						cache.method = Variant::get_builtin_method(base.get_type(), method);
+						cache.type = base.get_type();
+					}
+					if (p_const_calls_only && cache.method && !Variant::is_builtin_method_const(cache.method)) {
+						ce.error = Callable::CallError::CALL_ERROR_METHOD_NOT_CONST;
+					} else {
+						base.call_builtin_method(cache.method, argptrs, argcount, dst, ce);
+					}
+				} else if (p_const_calls_only) {
+					base.call_const(method, argptrs, argcount, dst, ce);
+				} else {
+					base.callp(method, argptrs, argcount, dst, ce);
+				}
 
-		} break;
+				if (ce.error != Callable::CallError::CALL_OK) {
+					r_error_str = vformat(RTR("On call to '%s':"), String(method));
+					failed = true;
+					break;
+				}
+				ip += 6 + argcount;
+			} break;
+		}
 	}
-	return false;
+
+	if (!failed) {
+		r_ret = *GET_OPERAND(result_address);
+	}
+
+#undef GET_OPERAND
+
+	for (int i = 0; i < register_count; i++) {
+		registers[i].~Variant();
+	}
+
+	return failed;
 }
 
 Error Expression::parse(const String &p_expression, const Vector<String> &p_input_names) {
@@ -1473,6 +1680,7 @@ Error Expression::parse(const String &p_expression, const Vector<String> &p_inpu
 		nodes = nullptr;
 		root = nullptr;
 	}
+	_clear_program();
 
 	error_str = String();
 	error_set = false;
@@ -1491,6 +1699,8 @@ Error Expression::parse(const String &p_expression, const Vector<String> &p_inpu
 		return ERR_INVALID_PARAMETER;
 	}
 
+	_compile();
+
 	return OK;
 }
 
@@ -1500,7 +1710,7 @@ Variant Expression::execute(Array p_inputs, Object *p_base, bool p_show_error, b
 	execution_error = false;
 	Variant output;
 	String error_txt;
-	bool err = _execute(p_inputs, p_base, root, output, p_const_calls_only, error_txt);
+	bool err = _execute(p_inputs, p_base, output, p_const_calls_only, error_txt);
 	if (err) {
 		execution_error = true;
 		error_str = error_txt;
@@ -1510,6 +1720,29 @@ Variant Expression::execute(Array p_inputs, Object *p_base, bool p_show_error, b
 	return output;
 }
 
+Array Expression::execute_many(const Array &p_inputs_array, Object *p_base, bool p_show_error, bool p_const_calls_only) {
+	ERR_FAIL_COND_V_MSG(error_set, Array(), "There was previously a parse error: " + error_str + ".");
+
+	execution_error = false;
+	Array outputs;
+	outputs.resize(p_inputs_array.size());
+	String error_txt;
+	for (int i = 0; i < p_inputs_array.size(); i++) {
+		Variant output;
+		bool err = _execute(p_inputs_array[i], p_base, output, p_const_calls_only, error_txt);
+		if (err) {
+			execution_error = true;
+			error_str = error_txt;
+			outputs.resize(i);
+			ERR_FAIL_COND_V_MSG(p_show_error, outputs, error_str);
+			break;
+		}
+		outputs[i] = output;
+	}
+
+	return outputs;
+}
+
 bool Expression::has_execute_failed() const {
 	return execution_error;
 }
@@ -1521,6 +1754,7 @@ String Expression::get_error_text() const {
 void Expression::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("parse", "expression", "input_names"), &Expression::parse, DEFVAL(Vector<String>()));
 	ClassDB::bind_method(D_METHOD("execute", "inputs", "base_instance", "show_error", "const_calls_only"), &Expression::execute, DEFVAL(Array()), DEFVAL(Variant()), DEFVAL(true), DEFVAL(false));
+	ClassDB::bind_method(D_METHOD("execute_many", "inputs_array", "base_instance", "show_error", "const_calls_only"), &Expression::execute_many, DEFVAL(Variant()), DEFVAL(true), DEFVAL(false));
 	ClassDB::bind_method(D_METHOD("has_execute_failed"), &Expression::has_execute_failed);
 	ClassDB::bind_method(D_METHOD("get_error_text"), &Expression::get_error_text);
 }
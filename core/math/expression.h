@@ -32,6 +32,7 @@
 #define EXPRESSION_H
 
 #include "core/object/ref_counted.h"
+#include "core/templates/local_vector.h"
 
 class Expression : public RefCounted {
 	GDCLASS(Expression, RefCounted);
@@ -256,8 +257,52 @@ private:
 
 	Vector<String> input_names;
 
+	// The parsed tree is compiled to a flat list of instructions working on registers, so executing
+	// it doesn't need to walk the tree. Operands are addresses, which can point to a register, a
+	// constant or an input.
+	enum Opcode {
+		OPCODE_SELF, // dst
+		OPCODE_OPERATOR, // dst, operator, a, b
+		OPCODE_INDEX, // dst, base, index
+		OPCODE_NAMED_INDEX, // dst, base, name
+		OPCODE_ARRAY, // dst, count, elements...
+		OPCODE_DICTIONARY, // dst, count, keys and values...
+		OPCODE_CONSTRUCT, // dst, type, argcount, arguments...
+		OPCODE_BUILTIN_FUNC, // dst, name, argcount, arguments...
+		OPCODE_CALL, // dst, base, name, call cache, argcount, arguments...
+	};
+
+	enum AddressType {
+		ADDRESS_REGISTER,
+		ADDRESS_CONSTANT,
+		ADDRESS_INPUT,
+		ADDRESS_TYPE_BITS = 2,
+		ADDRESS_TYPE_MASK = (1 << ADDRESS_TYPE_BITS) - 1,
+	};
+
+	struct CallCache {
+		// Built-in methods are resolved on the first call, and again only if the type of the base changes.
+		Variant::Type type = Variant::NIL;
+		Variant::BuiltInMethod method = nullptr;
+	};
+
+	LocalVector<int> code;
+	LocalVector<Variant> constants;
+	LocalVector<StringName> names;
+	LocalVector<CallCache> call_caches;
+	LocalVector<int> used_inputs; // In the order they are evaluated.
+	int register_count = 0;
+	int max_argument_count = 0;
+	int result_address = 0;
+
+	int _add_constant(const Variant &p_value);
+	int _add_name(const StringName &p_name);
+	int _compile_node(ENode *p_node);
+	void _compile();
+	void _clear_program();
+
 	bool execution_error = false;
-	bool _execute(const Array &p_inputs, Object *p_instance, Expression::ENode *p_node, Variant &r_ret, bool p_const_calls_only, String &r_error_str);
+	bool _execute(const Array &p_inputs, Object *p_instance, Variant &r_ret, bool p_const_calls_only, String &r_error_str);
 
 protected:
 	static void _bind_methods();
@@ -265,6 +310,7 @@ protected:
 public:
 	Error parse(const String &p_expression, const Vector<String> &p_input_names = Vector<String>());
 	Variant execute(Array p_inputs = Array(), Object *p_base = nullptr, bool p_show_error = true, bool p_const_calls_only = false);
+	Array execute_many(const Array &p_inputs_array, Object *p_base = nullptr, bool p_show_error = true, bool p_const_calls_only = false);
 	bool has_execute_failed() const;
 	String get_error_text() const;
 
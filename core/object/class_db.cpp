@@ -1376,6 +1376,32 @@ StringName ClassDB::get_property_getter(const StringName &p_class, const StringN
 	return StringName();
 }
 
+MethodBind *ClassDB::get_property_getter_bind(const StringName &p_class, const StringName &p_property) {
+	ClassInfo *type = classes.getptr(p_class);
+	if (type && type->gdextension) {
+		// Extension instances may override the getter, and their classes can be unloaded.
+		return nullptr;
+	}
+
+	ClassInfo *check = type;
+	while (check) {
+		const PropertySetGet *psg = check->property_setget.getptr(p_property);
+		if (psg) {
+			// Indexed getters need the index as argument, so they can't be called directly.
+			return psg->index < 0 ? psg->_getptr : nullptr;
+		}
+
+		// Same lookup order as get_property(), where these shadow inherited properties.
+		if (check->constant_map.has(p_property) || check->method_map.has(p_property) || check->signal_map.has(p_property)) {
+			return nullptr;
+		}
+
+		check = check->inherits_ptr;
+	}
+
+	return nullptr;
+}
+
 bool ClassDB::has_property(const StringName &p_class, const StringName &p_property, bool p_no_inheritance) {
 	ClassInfo *type = classes.getptr(p_class);
 	ClassInfo *check = type;
@@ -1087,6 +1087,10 @@ Error Object::emit_signalp(const StringName &p_name, const Variant **p_args, int
 		return ERR_UNAVAILABLE;
 	}
 
+	if (s->slot_map.is_empty()) {
+		return OK;
+	}
+
 	// If this is a ref-counted object, prevent it from being destroyed during signal emission,
 	// which is needed in certain edge cases; e.g., https://github.com/godotengine/godot/issues/73889.
 	Ref<RefCounted> rc = Ref<RefCounted>(Object::cast_to<RefCounted>(this));
@@ -1095,22 +1099,42 @@ Error Object::emit_signalp(const StringName &p_name, const Variant **p_args, int
 
 	// Ensure that disconnecting the signal or even deleting the object
 	// will not affect the signal calling.
-	LocalVector<Connection> slot_conns;
-	slot_conns.resize(s->slot_map.size());
+	// Only the callables and flags are needed. Up to MAX_STACK_SLOTS of them are
+	// copied on the stack, so neither many connections nor reentrant emissions
+	// can overflow it, and larger signals fall back to the heap.
+	const uint32_t MAX_STACK_SLOTS = 16;
+	const uint32_t slot_count = s->slot_map.size();
+	Callable stack_callables[MAX_STACK_SLOTS];
+	uint32_t stack_flags[MAX_STACK_SLOTS];
+	LocalVector<Callable> heap_callables;
+	LocalVector<uint32_t> heap_flags;
+	Callable *slot_callables = stack_callables;
+	uint32_t *slot_flags = stack_flags;
+	if (slot_count > MAX_STACK_SLOTS) {
+		heap_callables.resize(slot_count);
+		heap_flags.resize(slot_count);
+		slot_callables = heap_callables.ptr();
+		slot_flags = heap_flags.ptr();
+	}
 	{
 		uint32_t idx = 0;
 		for (const KeyValue<Callable, SignalData::Slot> &slot_kv : s->slot_map) {
-			slot_conns[idx++] = slot_kv.value.conn;
+			slot_callables[idx] = slot_kv.value.conn.callable;
+			slot_flags[idx] = slot_kv.value.conn.flags;
+			idx++;
 		}
-		DEV_ASSERT(idx == s->slot_map.size());
+		DEV_ASSERT(idx == slot_count);
 	}
 
 	OBJ_DEBUG_LOCK
 
 	Error err = OK;
 
-	for (const Connection &c : slot_conns) {
-		if (!c.callable.is_valid()) {
+	for (uint32_t i = 0; i < slot_count; i++) {
+		const Callable &callable = slot_callables[i];
+		const uint32_t flags = slot_flags[i];
+
+		if (!callable.is_valid()) {
 			// Target might have been deleted during signal callback, this is expected and OK.
 			continue;
 		}
@@ -1118,34 +1142,34 @@ Error Object::emit_signalp(const StringName &p_name, const Variant **p_args, int
 		const Variant **args = p_args;
 		int argc = p_argcount;
 
-		if (c.flags & CONNECT_DEFERRED) {
-			MessageQueue::get_singleton()->push_callablep(c.callable, args, argc, true);
+		if (flags & CONNECT_DEFERRED) {
+			MessageQueue::get_singleton()->push_callablep(callable, args, argc, true);
 		} else {
 			Callable::CallError ce;
 			_emitting = true;
 			Variant ret;
-			c.callable.callp(args, argc, ret, ce);
+			callable.callp(args, argc, ret, ce);
 			_emitting = false;
 
 			if (ce.error != Callable::CallError::CALL_OK) {
 #ifdef DEBUG_ENABLED
-				if (c.flags & CONNECT_PERSIST && Engine::get_singleton()->is_editor_hint() && (script.is_null() || !Ref<Script>(script)->is_tool())) {
+				if (flags & CONNECT_PERSIST && Engine::get_singleton()->is_editor_hint() && (script.is_null() || !Ref<Script>(script)->is_tool())) {
 					continue;
 				}
 #endif
-				Object *target = c.callable.get_object();
+				Object *target = callable.get_object();
 				if (ce.error == Callable::CallError::CALL_ERROR_INVALID_METHOD && target && !ClassDB::class_exists(target->get_class_name())) {
 					//most likely object is not initialized yet, do not throw error.
 				} else {
-					ERR_PRINT("Error calling from signal '" + String(p_name) + "' to callable: " + Variant::get_callable_error_text(c.callable, args, argc, ce) + ".");
+					ERR_PRINT("Error calling from signal '" + String(p_name) + "' to callable: " + Variant::get_callable_error_text(callable, args, argc, ce) + ".");
 					err = ERR_METHOD_NOT_FOUND;
 				}
 			}
 		}
 
-		bool disconnect = c.flags & CONNECT_ONE_SHOT;
+		bool disconnect = flags & CONNECT_ONE_SHOT;
 #ifdef TOOLS_ENABLED
-		if (disconnect && (c.flags & CONNECT_PERSIST) && Engine::get_singleton()->is_editor_hint()) {
+		if (disconnect && (flags & CONNECT_PERSIST) && Engine::get_singleton()->is_editor_hint()) {
 			//this signal was connected from the editor, and is being edited. just don't disconnect for now
 			disconnect = false;
 		}
@@ -1153,11 +1177,15 @@ Error Object::emit_signalp(const StringName &p_name, const Variant **p_args, int
 		if (disconnect) {
 			_ObjectSignalDisconnectData dd;
 			dd.signal = p_name;
-			dd.callable = c.callable;
+			dd.callable = callable;
 			disconnect_data.push_back(dd);
 		}
 	}
 
+	for (uint32_t i = 0; i < slot_count; i++) {
+		slot_callables[i] = Callable();
+	}
+
 	while (!disconnect_data.is_empty()) {
 		const _ObjectSignalDisconnectData &dd = disconnect_data.front()->get();
 
@@ -44,13 +44,54 @@ void WorkerThreadPool::Task::free_template_userdata() {
 WorkerThreadPool *WorkerThreadPool::singleton = nullptr;
 
 void WorkerThreadPool::_process_task_queue() {
-	task_mutex.lock();
-	Task *task = task_queue.first()->self();
-	task_queue.remove(task_queue.first());
-	task_mutex.unlock();
+	// Only pool threads get here, once they have claimed a task from task_available_semaphore.
+	Task *task = _take_queued_task(thread_ids[Thread::get_caller_id()]);
 	_process_task(task);
 }
 
+WorkerThreadPool::Task *WorkerThreadPool::_take_queued_task(uint32_t p_thread_index) {
+	ThreadData &curr_thread = threads[p_thread_index];
+	const uint32_t thread_count = threads.size();
+
+	// The semaphore guarantees there is a task queued somewhere for us, but stealing
+	// can fail while racing against other threads, so keep looking until it's found.
+	while (true) {
+		Task *task = nullptr;
+
+		// Own queue first, newest task first, since its data is likely still in cache.
+		if (curr_thread.work_queue.pop(task)) {
+			return task;
+		}
+		if (curr_thread.inbox.pop(task)) {
+			return task;
+		}
+
+		if (task_queue_size.get() > 0) {
+			task_mutex.lock();
+			SelfList<Task> *first = task_queue.first();
+			if (first) {
+				task_queue.remove(first);
+				task_queue_size.decrement();
+				task_mutex.unlock();
+				return first->self();
+			}
+			task_mutex.unlock();
+		}
+
+		// Steal the oldest task of another thread, starting from the last successful victim.
+		for (uint32_t i = 0; i < thread_count; i++) {
+			uint32_t victim = (curr_thread.steal_cursor + i) % thread_count;
+			if (victim == p_thread_index) {
+				continue;
+			}
+			if (threads[victim].work_queue.steal(task) || threads[victim].inbox.pop(task)) {
+				curr_thread.steal_cursor = victim;
+				return task;
+			}
+		}
+	}
+}
+
 void WorkerThreadPool::_process_task(Task *p_task) {
 	bool low_priority = p_task->low_priority;
 	int pool_thread_index = -1;
@@ -69,16 +110,22 @@ void WorkerThreadPool::_process_task(Task *p_task) {
 			ScriptServer::thread_enter();
 			curr_thread.ready_for_scripting = true;
 		}
-		task_mutex.lock();
-		p_task->pool_thread_index = pool_thread_index;
-		if (low_priority) {
-			low_priority_tasks_running++;
-			prev_low_prio_task = curr_thread.current_low_prio_task;
-			curr_thread.current_low_prio_task = p_task;
+		if (low_priority || !p_task->group) {
+			task_mutex.lock();
+			p_task->pool_thread_index = pool_thread_index;
+			if (low_priority) {
+				low_priority_tasks_running++;
+				prev_low_prio_task = curr_thread.current_low_prio_task;
+				curr_thread.current_low_prio_task = p_task;
+			} else {
+				curr_thread.current_low_prio_task = nullptr;
+			}
+			task_mutex.unlock();
 		} else {
+			// Nobody waits on the individual tasks of a group, so there's no shared state to update.
+			// This keeps the common case of many small high priority group tasks off the mutex.
 			curr_thread.current_low_prio_task = nullptr;
 		}
-		task_mutex.unlock();
 	}
 
 	if (p_task->group) {
@@ -163,11 +210,12 @@ void WorkerThreadPool::_process_task(Task *p_task) {
 	p_task = nullptr;
 
 	if (!use_native_low_priority_threads) {
-		bool post = false;
-		task_mutex.lock();
+		// Only this thread ever looks at its current low priority task.
 		ThreadData &curr_thread = threads[pool_thread_index];
 		curr_thread.current_low_prio_task = prev_low_prio_task;
 		if (low_priority) {
+			bool post = false;
+			task_mutex.lock();
 			low_priority_threads_used--;
 			low_priority_tasks_running--;
 			// A low prioriry task was freed, so see if we can move a pending one to the high priority queue.
@@ -178,10 +226,10 @@ void WorkerThreadPool::_process_task(Task *p_task) {
 			if (low_priority_tasks_awaiting_others == low_priority_tasks_running) {
 				_prevent_low_prio_saturation_deadlock();
 			}
-		}
-		task_mutex.unlock();
-		if (post) {
-			task_available_semaphore.post();
+			task_mutex.unlock();
+			if (post) {
+				task_available_semaphore.post();
+			}
 		}
 	}
 }
@@ -202,36 +250,87 @@ void WorkerThreadPool::_native_low_priority_thread_function(void *p_user) {
 }
 
 void WorkerThreadPool::_post_task(Task *p_task, bool p_high_priority) {
+	_post_tasks(&p_task, 1, p_high_priority);
+}
+
+void WorkerThreadPool::_post_tasks(Task **p_tasks, uint32_t p_count, bool p_high_priority) {
 	// Fall back to processing on the calling thread if there are no worker threads.
 	// Separated into its own variable to make it easier to extend this logic
 	// in custom builds.
 	bool process_on_calling_thread = threads.size() == 0;
 	if (process_on_calling_thread) {
-		_process_task(p_task);
+		for (uint32_t i = 0; i < p_count; i++) {
+			_process_task(p_tasks[i]);
+		}
 		return;
 	}
 
-	task_mutex.lock();
-	p_task->low_priority = !p_high_priority;
-	if (!p_high_priority && use_native_low_priority_threads) {
-		p_task->low_priority_thread = native_thread_allocator.alloc();
-		task_mutex.unlock();
+	if (p_high_priority) {
+		uint32_t posted = 0;
+
+		const int *caller_pool_th_index = thread_ids.getptr(Thread::get_caller_id());
+		if (caller_pool_th_index) {
+			// Posting from a pool thread, so it can push to its own queue without locking.
+			// Idle threads will steal from it.
+			WorkStealingQueue<Task *> &work_queue = threads[*caller_pool_th_index].work_queue;
+			while (posted < p_count) {
+				p_tasks[posted]->low_priority = false;
+				if (!work_queue.push(p_tasks[posted])) {
+					break; // Full, the rest goes to the shared queue.
+				}
+				posted++;
+			}
+		} else {
+			// Posting from another thread, so spread the tasks over the inboxes of the pool threads.
+			// Concurrent posters only contend on the atomics of the inboxes, not on task_mutex.
+			const uint32_t first = inbox_cursor.postadd(p_count);
+			while (posted < p_count) {
+				p_tasks[posted]->low_priority = false;
+				if (!threads[(first + posted) % threads.size()].inbox.push(p_tasks[posted])) {
+					break; // Full, the rest goes to the shared queue.
+				}
+				posted++;
+			}
+		}
 
-		if (p_task->group) {
-			p_task->group->low_priority_native_tasks.push_back(p_task);
+		if (posted < p_count) {
+			task_mutex.lock();
+			for (uint32_t i = posted; i < p_count; i++) {
+				p_tasks[i]->low_priority = false;
+				task_queue.add_last(&p_tasks[i]->task_elem);
+			}
+			task_queue_size.add(p_count - posted);
+			task_mutex.unlock();
 		}
-		p_task->low_priority_thread->start(_native_low_priority_thread_function, p_task); // Pask task directly to thread.
-	} else if (p_high_priority || low_priority_threads_used < max_low_priority_threads) {
-		task_queue.add_last(&p_task->task_elem);
-		if (!p_high_priority) {
+
+		task_available_semaphore.post(p_count);
+		return;
+	}
+
+	for (uint32_t i = 0; i < p_count; i++) {
+		Task *task = p_tasks[i];
+
+		task_mutex.lock();
+		task->low_priority = true;
+		if (use_native_low_priority_threads) {
+			task->low_priority_thread = native_thread_allocator.alloc();
+			task_mutex.unlock();
+
+			if (task->group) {
+				task->group->low_priority_native_tasks.push_back(task);
+			}
+			task->low_priority_thread->start(_native_low_priority_thread_function, task); // Pask task directly to thread.
+		} else if (low_priority_threads_used < max_low_priority_threads) {
+			task_queue.add_last(&task->task_elem);
+			task_queue_size.increment();
 			low_priority_threads_used++;
+			task_mutex.unlock();
+			task_available_semaphore.post();
+		} else {
+			// Too many threads using low priority, must go to queue.
+			low_priority_task_queue.add_last(&task->task_elem);
+			task_mutex.unlock();
 		}
-		task_mutex.unlock();
-		task_available_semaphore.post();
-	} else {
-		// Too many threads using low priority, must go to queue.
-		low_priority_task_queue.add_last(&p_task->task_elem);
-		task_mutex.unlock();
 	}
 }
 
@@ -240,6 +339,7 @@ bool WorkerThreadPool::_try_promote_low_priority_task() {
 		Task *low_prio_task = low_priority_task_queue.first()->self();
 		low_priority_task_queue.remove(low_priority_task_queue.first());
 		task_queue.add_last(&low_prio_task->task_elem);
+		task_queue_size.increment();
 		low_priority_threads_used++;
 		return true;
 	} else {
@@ -258,6 +358,7 @@ void WorkerThreadPool::_prevent_low_prio_saturation_deadlock() {
 		if (to_promote) {
 			low_priority_task_queue.remove(to_promote);
 			task_queue.add_last(to_promote);
+			task_queue_size.increment();
 			low_priority_threads_used++;
 			task_available_semaphore.post();
 		}
@@ -457,8 +558,8 @@ WorkerThreadPool::GroupID WorkerThreadPool::_add_group_task(const Callable &p_ca
 	groups[id] = group;
 	task_mutex.unlock();
 
-	for (int i = 0; i < p_tasks; i++) {
-		_post_task(tasks_posted[i], p_high_priority);
+	if (p_tasks > 0) {
+		_post_tasks(tasks_posted, p_tasks, p_high_priority);
 	}
 
 	return id;
@@ -39,6 +39,8 @@
 #include "core/templates/paged_allocator.h"
 #include "core/templates/rid.h"
 #include "core/templates/safe_refcount.h"
+#include "core/templates/mpmc_queue.h"
+#include "core/templates/work_stealing_queue.h"
 
 class WorkerThreadPool : public Object {
 	GDCLASS(WorkerThreadPool, Object)
@@ -97,19 +99,27 @@ private:
 	PagedAllocator<Thread> native_thread_allocator;
 
 	SelfList<Task>::List low_priority_task_queue;
-	SelfList<Task>::List task_queue;
+	SelfList<Task>::List task_queue; // Shared queue, fed by low priority tasks and when the per-thread queues are full.
+	SafeNumeric<uint32_t> task_queue_size; // Lets workers skip locking when the shared queue is empty.
 
 	Mutex task_mutex;
-	Semaphore task_available_semaphore;
+	Semaphore task_available_semaphore; // Counts tasks across the shared queue and all per-thread queues.
 
 	struct ThreadData {
 		uint32_t index;
 		Thread thread;
 		Task *current_low_prio_task = nullptr;
 		bool ready_for_scripting = false;
+		// High priority tasks posted from this thread. Other pool threads steal from it when idle.
+		WorkStealingQueue<Task *> work_queue;
+		// High priority tasks posted from non-pool threads, spread over all pool threads.
+		// Any pool thread may take from it, but this one looks at it first.
+		MPMCQueue<Task *> inbox;
+		uint32_t steal_cursor = 0;
 	};
 
 	TightLocalVector<ThreadData> threads;
+	SafeNumeric<uint32_t> inbox_cursor; // Round-robin over the inboxes of the pool threads.
 	bool exit_threads = false;
 
 	HashMap<Thread::ID, int> thread_ids;
@@ -129,8 +139,10 @@ private:
 
 	void _process_task_queue();
 	void _process_task(Task *task);
+	Task *_take_queued_task(uint32_t p_thread_index);
 
 	void _post_task(Task *p_task, bool p_high_priority);
+	void _post_tasks(Task **p_tasks, uint32_t p_count, bool p_high_priority);
 
 	bool _try_promote_low_priority_task();
 	void _prevent_low_prio_saturation_deadlock();
@@ -33,8 +33,13 @@
 #include "core/error/error_macros.h"
 #include "core/templates/safe_refcount.h"
 
+#ifdef SMALL_OBJECT_ALLOCATOR_ENABLED
+#include "core/os/spin_lock.h"
+#endif
+
 #include <stdio.h>
 #include <stdlib.h>
+#include <string.h>
 
 void *operator new(size_t p_size, const char *p_description) {
 	return Memory::alloc_static(p_size, false);
@@ -65,14 +70,219 @@ SafeNumeric<uint64_t> Memory::max_usage;
 
 SafeNumeric<uint64_t> Memory::alloc_count;
 
+#ifdef SMALL_OBJECT_ALLOCATOR_ENABLED
+
+// Small blocks (header included) are served from size classes instead of malloc. Freed blocks go to a
+// cache local to the freeing thread, and are handed over in batches to a shared list when the cache
+// grows too large, so most allocations neither lock nor reach malloc. Memory taken by the size classes
+// is kept for reuse and never given back to the system.
+// The class of a block is deduced from the size stored in its header, so all allocations are prepadded.
+namespace SmallObjectAllocator {
+
+enum {
+	CLASS_GRANULARITY = 16,
+	CLASS_COUNT = 16,
+	MAX_BLOCK_SIZE = CLASS_GRANULARITY * CLASS_COUNT,
+	SLAB_SIZE = 64 * 1024,
+	BATCH_SIZE = 64,
+};
+
+struct Block {
+	Block *next;
+	Block *next_batch; // Only used by the first block of a batch in the shared lists.
+};
+
+struct SharedClass {
+	SpinLock lock;
+	Block *batches = nullptr;
+};
+
+static SharedClass shared_classes[CLASS_COUNT];
+
+struct ThreadCache {
+	Block *free_list[CLASS_COUNT];
+	uint32_t free_count[CLASS_COUNT];
+	bool released; // The thread is exiting, so blocks go to the shared lists directly.
+};
+
+// Trivially destructible, so it can still be used while other thread_local objects are destroyed.
+static thread_local ThreadCache thread_cache;
+
+static _FORCE_INLINE_ uint32_t get_class(size_t p_size) {
+	return (p_size - 1) / CLASS_GRANULARITY;
+}
+
+static void push_batch(uint32_t p_class, Block *p_batch) {
+	SharedClass &shared = shared_classes[p_class];
+	shared.lock.lock();
+	p_batch->next_batch = shared.batches;
+	shared.batches = p_batch;
+	shared.lock.unlock();
+}
+
+static Block *pop_batch(uint32_t p_class) {
+	SharedClass &shared = shared_classes[p_class];
+	shared.lock.lock();
+	Block *batch = shared.batches;
+	if (batch) {
+		shared.batches = batch->next_batch;
+	}
+	shared.lock.unlock();
+	return batch;
+}
+
+static void release_thread_cache() {
+	for (uint32_t i = 0; i < CLASS_COUNT; i++) {
+		if (thread_cache.free_list[i]) {
+			push_batch(i, thread_cache.free_list[i]);
+			thread_cache.free_list[i] = nullptr;
+			thread_cache.free_count[i] = 0;
+		}
+	}
+	thread_cache.released = true;
+}
+
+struct ThreadCacheReleaser {
+	bool registered = false;
+
+	~ThreadCacheReleaser() {
+		release_thread_cache();
+	}
+};
+
+static thread_local ThreadCacheReleaser thread_cache_releaser;
+
+static void refill(uint32_t p_class) {
+	thread_cache_releaser.registered = true;
+
+	Block *batch = pop_batch(p_class);
+	if (!batch) {
+		// Carve a new slab into blocks of this class.
+		size_t block_size = (p_class + 1) * CLASS_GRANULARITY;
+		uint32_t block_count = SLAB_SIZE / block_size;
+		uint8_t *slab = (uint8_t *)malloc(block_count * block_size);
+		if (!slab) {
+			return;
+		}
+		for (uint32_t i = 0; i < block_count; i++) {
+			Block *block = (Block *)(slab + i * block_size);
+			block->next = i + 1 < block_count ? (Block *)(slab + (i + 1) * block_size) : nullptr;
+		}
+		batch = (Block *)slab;
+	}
+
+	uint32_t count = 0;
+	for (Block *block = batch; block; block = block->next) {
+		count++;
+	}
+	thread_cache.free_list[p_class] = batch;
+	thread_cache.free_count[p_class] = count;
+}
+
+static void *alloc_block(size_t p_size) {
+	uint32_t class_idx = get_class(p_size);
+	if (unlikely(thread_cache.released)) {
+		return malloc((class_idx + 1) * CLASS_GRANULARITY);
+	}
+
+	if (unlikely(!thread_cache.free_list[class_idx])) {
+		refill(class_idx);
+		if (!thread_cache.free_list[class_idx]) {
+			return nullptr;
+		}
+	}
+
+	Block *block = thread_cache.free_list[class_idx];
+	thread_cache.free_list[class_idx] = block->next;
+	thread_cache.free_count[class_idx]--;
+	return block;
+}
+
+static void free_block(void *p_mem, size_t p_size) {
+	uint32_t class_idx = get_class(p_size);
+	Block *block = (Block *)p_mem;
+	if (unlikely(thread_cache.released)) {
+		block->next = nullptr;
+		push_batch(class_idx, block);
+		return;
+	}
+
+	if (unlikely(!thread_cache.free_list[class_idx])) {
+		// Threads that only free blocks, and never refill, also have to give them back when exiting.
+		thread_cache_releaser.registered = true;
+	}
+
+	block->next = thread_cache.free_list[class_idx];
+	thread_cache.free_list[class_idx] = block;
+	thread_cache.free_count[class_idx]++;
+
+	if (unlikely(thread_cache.free_count[class_idx] > BATCH_SIZE * 2)) {
+		// Hand the most recently freed blocks over, keeping the rest in the cache.
+		Block *batch = thread_cache.free_list[class_idx];
+		Block *last = batch;
+		for (uint32_t i = 1; i < BATCH_SIZE; i++) {
+			last = last->next;
+		}
+		thread_cache.free_list[class_idx] = last->next;
+		thread_cache.free_count[class_idx] -= BATCH_SIZE;
+		last->next = nullptr;
+		push_batch(class_idx, batch);
+	}
+}
+
+} // namespace SmallObjectAllocator
+
+static _FORCE_INLINE_ void *_alloc_block(size_t p_size) {
+	if (p_size <= SmallObjectAllocator::MAX_BLOCK_SIZE) {
+		return SmallObjectAllocator::alloc_block(p_size);
+	}
+	return malloc(p_size);
+}
+
+static _FORCE_INLINE_ void *_realloc_block(void *p_mem, size_t p_old_size, size_t p_size) {
+	bool old_small = p_old_size <= SmallObjectAllocator::MAX_BLOCK_SIZE;
+	bool small = p_size <= SmallObjectAllocator::MAX_BLOCK_SIZE;
+	if (!old_small && !small) {
+		return realloc(p_mem, p_size);
+	}
+	if (old_small && small && SmallObjectAllocator::get_class(p_old_size) == SmallObjectAllocator::get_class(p_size)) {
+		return p_mem;
+	}
+
+	void *mem = _alloc_block(p_size);
+	if (mem) {
+		memcpy(mem, p_mem, MIN(p_old_size, p_size));
+		if (old_small) {
+			SmallObjectAllocator::free_block(p_mem, p_old_size);
+		} else {
+			free(p_mem);
+		}
+	}
+	return mem;
+}
+
+static _FORCE_INLINE_ void _free_block(void *p_mem, size_t p_size) {
+	if (p_size <= SmallObjectAllocator::MAX_BLOCK_SIZE) {
+		SmallObjectAllocator::free_block(p_mem, p_size);
+	} else {
+		free(p_mem);
+	}
+}
+
+#endif // SMALL_OBJECT_ALLOCATOR_ENABLED
+
 void *Memory::alloc_static(size_t p_bytes, bool p_pad_align) {
-#ifdef DEBUG_ENABLED
+#if defined(DEBUG_ENABLED) || defined(SMALL_OBJECT_ALLOCATOR_ENABLED)
 	bool prepad = true;
 #else
 	bool prepad = p_pad_align;
 #endif
 
+#ifdef SMALL_OBJECT_ALLOCATOR_ENABLED
+	void *mem = _alloc_block(p_bytes + PAD_ALIGN);
+#else
 	void *mem = malloc(p_bytes + (prepad ? PAD_ALIGN : 0));
+#endif
 
 	ERR_FAIL_NULL_V(mem, nullptr);
 
@@ -101,7 +311,7 @@ void *Memory::realloc_static(void *p_memory, size_t p_bytes, bool p_pad_align) {
 
 	uint8_t *mem = (uint8_t *)p_memory;
 
-#ifdef DEBUG_ENABLED
+#if defined(DEBUG_ENABLED) || defined(SMALL_OBJECT_ALLOCATOR_ENABLED)
 	bool prepad = true;
 #else
 	bool prepad = p_pad_align;
@@ -121,12 +331,20 @@ void *Memory::realloc_static(void *p_memory, size_t p_bytes, bool p_pad_align) {
 #endif
 
 		if (p_bytes == 0) {
+#ifdef SMALL_OBJECT_ALLOCATOR_ENABLED
+			_free_block(mem, *s + PAD_ALIGN);
+#else
 			free(mem);
+#endif
 			return nullptr;
 		} else {
+#ifdef SMALL_OBJECT_ALLOCATOR_ENABLED
+			mem = (uint8_t *)_realloc_block(mem, *s + PAD_ALIGN, p_bytes + PAD_ALIGN);
+#else
 			*s = p_bytes;
 
 			mem = (uint8_t *)realloc(mem, p_bytes + PAD_ALIGN);
+#endif
 			ERR_FAIL_NULL_V(mem, nullptr);
 
 			s = (uint64_t *)mem;
@@ -149,7 +367,7 @@ void Memory::free_static(void *p_ptr, bool p_pad_align) {
 
 	uint8_t *mem = (uint8_t *)p_ptr;
 
-#ifdef DEBUG_ENABLED
+#if defined(DEBUG_ENABLED) || defined(SMALL_OBJECT_ALLOCATOR_ENABLED)
 	bool prepad = true;
 #else
 	bool prepad = p_pad_align;
@@ -160,12 +378,18 @@ void Memory::free_static(void *p_ptr, bool p_pad_align) {
 	if (prepad) {
 		mem -= PAD_ALIGN;
 
-#ifdef DEBUG_ENABLED
+#if defined(DEBUG_ENABLED) || defined(SMALL_OBJECT_ALLOCATOR_ENABLED)
 		uint64_t *s = (uint64_t *)mem;
+#endif
+#ifdef DEBUG_ENABLED
 		mem_usage.sub(*s);
 #endif
 
+#ifdef SMALL_OBJECT_ALLOCATOR_ENABLED
+		_free_block(mem, *s + PAD_ALIGN);
+#else
 		free(mem);
+#endif
 	} else {
 		free(mem);
 	}
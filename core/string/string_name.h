@@ -48,7 +48,12 @@ class StringName {
 	enum {
 		STRING_TABLE_BITS = 16,
 		STRING_TABLE_LEN = 1 << STRING_TABLE_BITS,
-		STRING_TABLE_MASK = STRING_TABLE_LEN - 1
+		STRING_TABLE_MASK = STRING_TABLE_LEN - 1,
+		// The table is split in shards, each one guarded by its own lock, so threads
+		// interning unrelated names don't contend with each other.
+		STRING_TABLE_SHARD_BITS = 6,
+		STRING_TABLE_SHARD_LEN = 1 << STRING_TABLE_SHARD_BITS,
+		STRING_TABLE_SHARD_MASK = STRING_TABLE_SHARD_LEN - 1
 	};
 
 	struct _Data {
@@ -69,6 +74,13 @@ class StringName {
 
 	static _Data *_table[STRING_TABLE_LEN];
 
+	struct alignas(64) _TableLock {
+		Mutex mutex;
+	};
+
+	static _TableLock _table_locks[STRING_TABLE_SHARD_LEN];
+	_FORCE_INLINE_ static Mutex &_get_table_mutex(uint32_t p_idx) { return _table_locks[p_idx & STRING_TABLE_SHARD_MASK].mutex; }
+
 	_Data *_data = nullptr;
 
 	union _HashUnion {
@@ -80,7 +92,7 @@ class StringName {
 	friend void register_core_types();
 	friend void unregister_core_types();
 	friend class Main;
-	static Mutex mutex;
+	static Mutex mutex; // Guards the assignment of static unique class names, and the table teardown in cleanup().
 	static void setup();
 	static void cleanup();
 	static bool configured;
@@ -31,7 +31,6 @@
 #include "command_queue_mt.h"
 
 #include "core/config/project_settings.h"
-#include "core/os/os.h"
 
 void CommandQueueMT::lock() {
 	mutex.lock();
@@ -41,33 +40,11 @@ void CommandQueueMT::unlock() {
 	mutex.unlock();
 }
 
-void CommandQueueMT::wait_for_flush() {
-	// wait one millisecond for a flush to happen
-	OS::get_singleton()->delay_usec(1000);
-}
-
-CommandQueueMT::SyncSemaphore *CommandQueueMT::_alloc_sync_sem() {
-	int idx = -1;
-
-	while (true) {
-		lock();
-		for (int i = 0; i < SYNC_SEMAPHORES; i++) {
-			if (!sync_sems[i].in_use) {
-				sync_sems[i].in_use = true;
-				idx = i;
-				break;
-			}
-		}
-		unlock();
-
-		if (idx == -1) {
-			wait_for_flush();
-		} else {
-			break;
-		}
-	}
-
-	return &sync_sems[idx];
+Semaphore *CommandQueueMT::_get_sync_sem() {
+	// A thread waits for a single synced command at a time, so it can always reuse its own semaphore
+	// instead of taking one from a shared pool.
+	static thread_local Semaphore sync_sem;
+	return &sync_sem;
 }
 
 CommandQueueMT::CommandQueueMT(bool p_sync) {
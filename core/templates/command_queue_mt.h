@@ -264,7 +264,7 @@
 #define DECL_PUSH_AND_RET(N)                                                                   \
 	template <class T, class M, COMMA_SEP_LIST(TYPE_PARAM, N) COMMA(N) class R>                \
 	void push_and_ret(T *p_instance, M p_method, COMMA_SEP_LIST(PARAM, N) COMMA(N) R *r_ret) { \
-		SyncSemaphore *ss = _alloc_sync_sem();                                                 \
+		Semaphore *ss = _get_sync_sem();                                                       \
 		CMD_RET_TYPE(N) *cmd = allocate_and_lock<CMD_RET_TYPE(N)>();                           \
 		cmd->instance = p_instance;                                                            \
 		cmd->method = p_method;                                                                \
@@ -274,8 +274,7 @@
 		unlock();                                                                              \
 		if (sync)                                                                              \
 			sync->post();                                                                      \
-		ss->sem.wait();                                                                        \
-		ss->in_use = false;                                                                    \
+		ss->wait();                                                                            \
 	}
 
 #define CMD_SYNC_TYPE(N) CommandSync##N<T, M COMMA(N) COMMA_SEP_LIST(TYPE_ARG, N)>
@@ -283,7 +282,7 @@
 #define DECL_PUSH_AND_SYNC(N)                                                         \
 	template <class T, class M COMMA(N) COMMA_SEP_LIST(TYPE_PARAM, N)>                \
 	void push_and_sync(T *p_instance, M p_method COMMA(N) COMMA_SEP_LIST(PARAM, N)) { \
-		SyncSemaphore *ss = _alloc_sync_sem();                                        \
+		Semaphore *ss = _get_sync_sem();                                              \
 		CMD_SYNC_TYPE(N) *cmd = allocate_and_lock<CMD_SYNC_TYPE(N)>();                \
 		cmd->instance = p_instance;                                                   \
 		cmd->method = p_method;                                                       \
@@ -292,18 +291,12 @@
 		unlock();                                                                     \
 		if (sync)                                                                     \
 			sync->post();                                                             \
-		ss->sem.wait();                                                               \
-		ss->in_use = false;                                                           \
+		ss->wait();                                                                   \
 	}
 
 #define MAX_CMD_PARAMS 15
 
 class CommandQueueMT {
-	struct SyncSemaphore {
-		Semaphore sem;
-		bool in_use = false;
-	};
-
 	struct CommandBase {
 		virtual void call() = 0;
 		virtual void post() {}
@@ -311,10 +304,10 @@ class CommandQueueMT {
 	};
 
 	struct SyncCommand : public CommandBase {
-		SyncSemaphore *sync_sem = nullptr;
+		Semaphore *sync_sem = nullptr;
 
 		virtual void post() override {
-			sync_sem->sem.post();
+			sync_sem->post();
 		}
 	};
 
@@ -333,22 +326,26 @@ class CommandQueueMT {
 
 	enum {
 		DEFAULT_COMMAND_MEM_SIZE_KB = 256,
-		SYNC_SEMAPHORES = 8
 	};
 
-	LocalVector<uint8_t> command_mem;
-	SyncSemaphore sync_sems[SYNC_SEMAPHORES];
+	// Commands are pushed to one buffer while the other one is being flushed,
+	// so pushing doesn't have to wait for all the pending commands to run.
+	LocalVector<uint8_t> command_mem[2];
+	uint32_t command_mem_write = 0;
 	Mutex mutex;
+	Mutex flush_mutex;
+	bool flushing = false;
 	Semaphore *sync = nullptr;
 
 	template <class T>
 	T *allocate() {
 		// alloc size is size+T+safeguard
 		uint32_t alloc_size = ((sizeof(T) + 8 - 1) & ~(8 - 1));
-		uint64_t size = command_mem.size();
-		command_mem.resize(size + alloc_size + 8);
-		*(uint64_t *)&command_mem[size] = alloc_size;
-		T *cmd = memnew_placement(&command_mem[size + 8], T);
+		LocalVector<uint8_t> &mem = command_mem[command_mem_write];
+		uint64_t size = mem.size();
+		mem.resize(size + alloc_size + 8);
+		*(uint64_t *)&mem[size] = alloc_size;
+		T *cmd = memnew_placement(&mem[size + 8], T);
 		return cmd;
 	}
 
@@ -360,15 +357,26 @@ class CommandQueueMT {
 	}
 
 	void _flush() {
+		MutexLock flush_lock(flush_mutex);
+		if (flushing) {
+			// A command being run flushed the queue again. Whatever it pushed went to the
+			// other buffer, and only runs on the next flush.
+			return;
+		}
+		flushing = true;
+
 		lock();
+		LocalVector<uint8_t> &mem = command_mem[command_mem_write];
+		command_mem_write ^= 1;
+		unlock();
 
 		uint64_t read_ptr = 0;
-		uint64_t limit = command_mem.size();
+		uint64_t limit = mem.size();
 
 		while (read_ptr < limit) {
-			uint64_t size = *(uint64_t *)&command_mem[read_ptr];
+			uint64_t size = *(uint64_t *)&mem[read_ptr];
 			read_ptr += 8;
-			CommandBase *cmd = reinterpret_cast<CommandBase *>(&command_mem[read_ptr]);
+			CommandBase *cmd = reinterpret_cast<CommandBase *>(&mem[read_ptr]);
 
 			cmd->call(); //execute the function
 			cmd->post(); //release in case it needs sync/ret
@@ -377,14 +385,13 @@ class CommandQueueMT {
 			read_ptr += size;
 		}
 
-		command_mem.clear();
-		unlock();
+		mem.clear();
+		flushing = false;
 	}
 
 	void lock();
 	void unlock();
-	void wait_for_flush();
-	SyncSemaphore *_alloc_sync_sem();
+	Semaphore *_get_sync_sem();
 
 public:
 	/* NORMAL PUSH COMMANDS */
@@ -400,7 +407,7 @@ public:
 	SPACE_SEP_LIST(DECL_PUSH_AND_SYNC, 15)
 
 	_FORCE_INLINE_ void flush_if_pending() {
-		if (unlikely(command_mem.size() > 0)) {
+		if (unlikely(command_mem[command_mem_write].size() > 0)) {
 			_flush();
 		}
 	}
@@ -0,0 +1,127 @@
+/**************************************************************************/
+/*  mpmc_queue.h                                                          */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#ifndef MPMC_QUEUE_H
+#define MPMC_QUEUE_H
+
+#include "core/typedefs.h"
+
+#include <atomic>
+#include <type_traits>
+
+// Bounded multi-producer, multi-consumer FIFO queue (Vyukov's sequenced ring buffer).
+// Any thread may call push() and pop(); neither locks, and each cell's sequence number
+// tells whether it's ready to be written or read for the current lap around the ring.
+// push() fails instead of growing when the queue is full, so callers need a fallback.
+template <class T, uint32_t CAPACITY = 256>
+class MPMCQueue {
+	static_assert(CAPACITY > 0 && (CAPACITY & (CAPACITY - 1)) == 0, "MPMCQueue capacity must be a power of two.");
+	static_assert(std::is_trivially_copyable<T>::value, "MPMCQueue elements must be trivially copyable.");
+
+	enum {
+		MASK = CAPACITY - 1,
+		CACHE_LINE_SIZE = 64,
+	};
+
+	struct Cell {
+		std::atomic<uint32_t> sequence;
+		T value;
+	};
+
+	// Keep the ends apart so producers and consumers don't invalidate each other's cache lines.
+	std::atomic<uint32_t> enqueue_pos = { 0 };
+	uint8_t _pad_enqueue[CACHE_LINE_SIZE - sizeof(std::atomic<uint32_t>)];
+	std::atomic<uint32_t> dequeue_pos = { 0 };
+	uint8_t _pad_dequeue[CACHE_LINE_SIZE - sizeof(std::atomic<uint32_t>)];
+	Cell cells[CAPACITY];
+
+public:
+	_FORCE_INLINE_ bool push(const T &p_value) {
+		uint32_t pos = enqueue_pos.load(std::memory_order_relaxed);
+		while (true) {
+			Cell &cell = cells[pos & MASK];
+			const int32_t diff = int32_t(cell.sequence.load(std::memory_order_acquire) - pos);
+			if (diff == 0) {
+				// Free in this lap, claim it.
+				if (enqueue_pos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+					cell.value = p_value;
+					cell.sequence.store(pos + 1, std::memory_order_release);
+					return true;
+				}
+			} else if (diff < 0) {
+				return false; // Still holds a value from the previous lap, so the queue is full.
+			} else {
+				pos = enqueue_pos.load(std::memory_order_relaxed); // Claimed by another producer.
+			}
+		}
+	}
+
+	_FORCE_INLINE_ bool pop(T &r_value) {
+		uint32_t pos = dequeue_pos.load(std::memory_order_relaxed);
+		while (true) {
+			Cell &cell = cells[pos & MASK];
+			const int32_t diff = int32_t(cell.sequence.load(std::memory_order_acquire) - (pos + 1));
+			if (diff == 0) {
+				if (dequeue_pos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+					r_value = cell.value;
+					cell.sequence.store(pos + CAPACITY, std::memory_order_release);
+					return true;
+				}
+			} else if (diff < 0) {
+				return false; // Not written yet, so the queue is empty.
+			} else {
+				pos = dequeue_pos.load(std::memory_order_relaxed); // Taken by another consumer.
+			}
+		}
+	}
+
+	// Approximate when other threads are pushing or popping.
+	_FORCE_INLINE_ uint32_t size() const {
+		const uint32_t e = enqueue_pos.load(std::memory_order_relaxed);
+		const uint32_t d = dequeue_pos.load(std::memory_order_relaxed);
+		return int32_t(e - d) > 0 ? e - d : 0;
+	}
+
+	_FORCE_INLINE_ bool is_empty() const {
+		return size() == 0;
+	}
+
+	_FORCE_INLINE_ constexpr uint32_t get_capacity() const {
+		return CAPACITY;
+	}
+
+	MPMCQueue() {
+		for (uint32_t i = 0; i < CAPACITY; i++) {
+			cells[i].sequence.store(i, std::memory_order_relaxed);
+		}
+	}
+};
+
+#endif // MPMC_QUEUE_H
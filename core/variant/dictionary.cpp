@@ -30,7 +30,7 @@
 
 #include "dictionary.h"
 
-#include "core/templates/hash_map.h"
+#include "core/templates/local_vector.h"
 #include "core/templates/safe_refcount.h"
 #include "core/variant/variant.h"
 // required in this order by VariantInternal, do not remove this comment.
@@ -40,24 +40,339 @@
 #include "core/variant/variant_internal.h"
 
 struct DictionaryPrivate {
+	// Entries are stored in pages that never move, so references to keys and values stay valid until
+	// their own entry is erased. Small dictionaries fit in their first page and are searched linearly,
+	// larger ones also keep an open-addressing table of entry positions.
+	// Live entries are linked in insertion order. Erased entries are linked in a free list and reused by
+	// later inserts, and a page is released once all of its entries are erased.
+	enum {
+		PAGE_SHIFT = 3,
+		PAGE_SIZE = 1 << PAGE_SHIFT,
+		PAGE_MASK = PAGE_SIZE - 1,
+		NONE = UINT32_MAX,
+	};
+
+	struct Entry {
+		Variant key;
+		Variant value;
+		uint32_t hash = 0;
+		// Insertion order for live entries, the free list for erased ones.
+		uint32_t prev = NONE;
+		uint32_t next = NONE;
+		bool erased = true;
+	};
+
+	struct ConstIterator {
+		const DictionaryPrivate *dictionary = nullptr;
+		uint32_t pos = NONE;
+
+		_FORCE_INLINE_ const Entry &operator*() const { return dictionary->get_entry(pos); }
+		_FORCE_INLINE_ const Entry *operator->() const { return &dictionary->get_entry(pos); }
+		_FORCE_INLINE_ ConstIterator &operator++() {
+			pos = dictionary->get_entry(pos).next;
+			return *this;
+		}
+		_FORCE_INLINE_ bool operator!=(const ConstIterator &p_other) const { return pos != p_other.pos; }
+	};
+
 	SafeRefCount refcount;
 	Variant *read_only = nullptr; // If enabled, a pointer is used to a temporary value that is used to return read-only values.
-	HashMap<Variant, Variant, VariantHasher, StringLikeVariantComparator> variant_map;
+
+	Entry *first_page = nullptr;
+	LocalVector<Entry *> pages; // Pages after the first one, null once released.
+	LocalVector<uint32_t> page_counts; // Live entries in each of the pages.
+	LocalVector<uint32_t> released_pages;
+	uint32_t used = 0; // Positions handed out, up to the end of the last page.
+	uint32_t count = 0;
+	uint32_t head = NONE;
+	uint32_t tail = NONE;
+	uint32_t free_head = NONE;
+	bool ordered = true; // Entry positions match the insertion order, with no gaps.
+
+	uint32_t *indices = nullptr; // Entry position + 1, or 0 for an empty slot.
+	uint32_t index_capacity = 0;
+	uint32_t index_used = 0;
+
+	_FORCE_INLINE_ Entry &get_entry(uint32_t p_pos) const {
+		if (p_pos < PAGE_SIZE) {
+			return first_page[p_pos];
+		}
+		return pages[(p_pos >> PAGE_SHIFT) - 1][p_pos & PAGE_MASK];
+	}
+
+	_FORCE_INLINE_ uint32_t size() const { return count; }
+	_FORCE_INLINE_ ConstIterator begin() const { return { this, head }; }
+	_FORCE_INLINE_ ConstIterator end() const { return { this, NONE }; }
+
+	int64_t find(const Variant &p_key) const {
+		if (count == 0) {
+			return -1;
+		}
+		uint32_t hash = VariantHasher::hash(p_key);
+
+		if (!indices) {
+			for (uint32_t i = 0; i < used; i++) {
+				const Entry &e = first_page[i];
+				if (!e.erased && e.hash == hash && StringLikeVariantComparator::compare(e.key, p_key)) {
+					return i;
+				}
+			}
+			return -1;
+		}
+
+		uint32_t mask = index_capacity - 1;
+		for (uint32_t slot = hash & mask; indices[slot]; slot = (slot + 1) & mask) {
+			const Entry &e = get_entry(indices[slot] - 1);
+			if (e.hash == hash && StringLikeVariantComparator::compare(e.key, p_key)) {
+				return indices[slot] - 1;
+			}
+		}
+		return -1;
+	}
+
+	void index_entry(uint32_t p_pos) {
+		uint32_t mask = index_capacity - 1;
+		uint32_t slot = get_entry(p_pos).hash & mask;
+		while (indices[slot]) {
+			slot = (slot + 1) & mask;
+		}
+		indices[slot] = p_pos + 1;
+		index_used++;
+	}
+
+	void unindex_entry(uint32_t p_pos) {
+		uint32_t mask = index_capacity - 1;
+		uint32_t slot = get_entry(p_pos).hash & mask;
+		while (indices[slot] != p_pos + 1) {
+			slot = (slot + 1) & mask;
+		}
+
+		// Shift back the entries probed past this slot, so no tombstones are needed.
+		for (uint32_t next = (slot + 1) & mask; indices[next]; next = (next + 1) & mask) {
+			uint32_t home = get_entry(indices[next] - 1).hash & mask;
+			if (((slot - home) & mask) < ((next - home) & mask)) {
+				indices[slot] = indices[next];
+				slot = next;
+			}
+		}
+		indices[slot] = 0;
+		index_used--;
+	}
+
+	void rebuild_index() {
+		if (indices) {
+			Memory::free_static(indices);
+		}
+		index_capacity = next_power_of_2(count * 2 + 1);
+		index_used = 0;
+		indices = (uint32_t *)Memory::alloc_static(sizeof(uint32_t) * index_capacity);
+		memset(indices, 0, sizeof(uint32_t) * index_capacity);
+		for (uint32_t pos = head; pos != NONE; pos = get_entry(pos).next) {
+			index_entry(pos);
+		}
+	}
+
+	void push_free(uint32_t p_pos) {
+		Entry &e = get_entry(p_pos);
+		e.prev = NONE;
+		e.next = free_head;
+		if (free_head != NONE) {
+			get_entry(free_head).prev = p_pos;
+		}
+		free_head = p_pos;
+	}
+
+	void unlink_free(uint32_t p_pos) {
+		Entry &e = get_entry(p_pos);
+		if (e.prev != NONE) {
+			get_entry(e.prev).next = e.next;
+		} else {
+			free_head = e.next;
+		}
+		if (e.next != NONE) {
+			get_entry(e.next).prev = e.prev;
+		}
+	}
+
+	uint32_t allocate_position() {
+		if (free_head == NONE) {
+			// Bring back a released page before growing.
+			while (!released_pages.is_empty()) {
+				uint32_t page = released_pages[released_pages.size() - 1];
+				released_pages.resize(released_pages.size() - 1);
+				if (page < pages.size() && !pages[page]) {
+					pages[page] = memnew_arr(Entry, PAGE_SIZE);
+					for (uint32_t i = PAGE_SIZE; i > 0; i--) {
+						push_free(((page + 1) << PAGE_SHIFT) + i - 1);
+					}
+					break;
+				}
+			}
+		}
+
+		if (free_head != NONE) {
+			uint32_t pos = free_head;
+			unlink_free(pos);
+			ordered = false;
+			return pos;
+		}
+
+		if (used == 0) {
+			if (!first_page) {
+				first_page = memnew_arr(Entry, PAGE_SIZE);
+			}
+		} else if ((used & PAGE_MASK) == 0) {
+			pages.push_back(memnew_arr(Entry, PAGE_SIZE));
+			page_counts.push_back(0);
+		}
+		return used++;
+	}
+
+	void release_page(uint32_t p_page) {
+		uint32_t from = (p_page + 1) << PAGE_SHIFT;
+		for (uint32_t pos = from; pos < MIN(from + (uint32_t)PAGE_SIZE, used); pos++) {
+			unlink_free(pos);
+		}
+		memdelete_arr(pages[p_page]);
+		pages[p_page] = nullptr;
+
+		if (p_page + 1 < pages.size()) {
+			released_pages.push_back(p_page);
+			return;
+		}
+
+		// Trailing pages are dropped, so positions are handed out from there again.
+		while (!pages.is_empty() && !pages[pages.size() - 1]) {
+			pages.resize(pages.size() - 1);
+			page_counts.resize(pages.size());
+		}
+		used = (pages.size() + 1) << PAGE_SHIFT;
+		for (uint32_t i = 0; i < released_pages.size(); i++) {
+			if (released_pages[i] >= pages.size()) {
+				released_pages.remove_at_unordered(i);
+				i--;
+			}
+		}
+	}
+
+	Entry &insert(const Variant &p_key) {
+		uint32_t pos = allocate_position();
+
+		Entry &e = get_entry(pos);
+		e.key = p_key;
+		e.hash = VariantHasher::hash(p_key);
+		e.erased = false;
+		e.prev = tail;
+		e.next = NONE;
+		if (tail != NONE) {
+			get_entry(tail).next = pos;
+		} else {
+			head = pos;
+		}
+		tail = pos;
+		count++;
+		if (pos >= PAGE_SIZE) {
+			page_counts[(pos >> PAGE_SHIFT) - 1]++;
+		}
+
+		if (indices && (index_used + 1) * 2 <= index_capacity) {
+			index_entry(pos);
+		} else if (indices || used > PAGE_SIZE) {
+			rebuild_index();
+		}
+		return e;
+	}
+
+	void erase_at(uint32_t p_pos) {
+		if (count == 1) {
+			clear(); // Nothing else is left, so all pages can be released.
+			return;
+		}
+
+		if (indices) {
+			unindex_entry(p_pos);
+		}
+
+		Entry &e = get_entry(p_pos);
+		if (e.prev != NONE) {
+			get_entry(e.prev).next = e.next;
+		} else {
+			head = e.next;
+		}
+		if (e.next != NONE) {
+			get_entry(e.next).prev = e.prev;
+		} else {
+			tail = e.prev;
+		}
+
+		e.key = Variant();
+		e.value = Variant();
+		e.erased = true;
+		count--;
+		ordered = false;
+		push_free(p_pos);
+
+		if (p_pos >= PAGE_SIZE) {
+			uint32_t page = (p_pos >> PAGE_SHIFT) - 1;
+			page_counts[page]--;
+			if (page_counts[page] == 0) {
+				release_page(page);
+			}
+		}
+	}
+
+	void clear() {
+		if (first_page) {
+			memdelete_arr(first_page);
+			first_page = nullptr;
+		}
+		for (Entry *page : pages) {
+			if (page) {
+				memdelete_arr(page);
+			}
+		}
+		pages.reset();
+		page_counts.reset();
+		released_pages.reset();
+		if (indices) {
+			Memory::free_static(indices);
+			indices = nullptr;
+		}
+		used = 0;
+		count = 0;
+		head = NONE;
+		tail = NONE;
+		free_head = NONE;
+		ordered = true;
+		index_capacity = 0;
+		index_used = 0;
+	}
+
+	~DictionaryPrivate() {
+		clear();
+	}
 };
 
 void Dictionary::get_key_list(List<Variant> *p_keys) const {
-	if (_p->variant_map.is_empty()) {
+	if (_p->size() == 0) {
 		return;
 	}
 
-	for (const KeyValue<Variant, Variant> &E : _p->variant_map) {
+	for (const DictionaryPrivate::Entry &E : *_p) {
 		p_keys->push_back(E.key);
 	}
 }
 
 Variant Dictionary::get_key_at_index(int p_index) const {
+	if (p_index < 0 || (uint32_t)p_index >= _p->size()) {
+		return Variant();
+	}
+	if (_p->ordered) {
+		return _p->get_entry(p_index).key;
+	}
+
 	int index = 0;
-	for (const KeyValue<Variant, Variant> &E : _p->variant_map) {
+	for (const DictionaryPrivate::Entry &E : *_p) {
 		if (index == p_index) {
 			return E.key;
 		}
@@ -68,8 +383,15 @@ Variant Dictionary::get_key_at_index(int p_index) const {
 }
 
 Variant Dictionary::get_value_at_index(int p_index) const {
+	if (p_index < 0 || (uint32_t)p_index >= _p->size()) {
+		return Variant();
+	}
+	if (_p->ordered) {
+		return _p->get_entry(p_index).value;
+	}
+
 	int index = 0;
-	for (const KeyValue<Variant, Variant> &E : _p->variant_map) {
+	for (const DictionaryPrivate::Entry &E : *_p) {
 		if (index == p_index) {
 			return E.value;
 		}
@@ -80,65 +402,63 @@ Variant Dictionary::get_value_at_index(int p_index) const {
 }
 
 Variant &Dictionary::operator[](const Variant &p_key) {
+	int64_t pos = _p->find(p_key);
 	if (unlikely(_p->read_only)) {
-		if (p_key.get_type() == Variant::STRING_NAME) {
-			const StringName *sn = VariantInternal::get_string_name(&p_key);
-			const String &key = sn->operator String();
-			if (likely(_p->variant_map.has(key))) {
-				*_p->read_only = _p->variant_map[key];
-			} else {
-				*_p->read_only = Variant();
-			}
-		} else if (likely(_p->variant_map.has(p_key))) {
-			*_p->read_only = _p->variant_map[p_key];
+		if (likely(pos >= 0)) {
+			*_p->read_only = _p->get_entry(pos).value;
 		} else {
 			*_p->read_only = Variant();
 		}
 
 		return *_p->read_only;
 	} else {
+		if (pos >= 0) {
+			return _p->get_entry(pos).value;
+		}
 		if (p_key.get_type() == Variant::STRING_NAME) {
 			const StringName *sn = VariantInternal::get_string_name(&p_key);
-			return _p->variant_map[sn->operator String()];
+			return _p->insert(sn->operator String()).value;
 		} else {
-			return _p->variant_map[p_key];
+			return _p->insert(p_key).value;
 		}
 	}
 }
 
 const Variant &Dictionary::operator[](const Variant &p_key) const {
 	// Will not insert key, so no conversion is necessary.
-	return _p->variant_map[p_key];
+	int64_t pos = _p->find(p_key);
+	CRASH_COND(pos < 0);
+	return _p->get_entry(pos).value;
 }
 
 const Variant *Dictionary::getptr(const Variant &p_key) const {
-	HashMap<Variant, Variant, VariantHasher, StringLikeVariantComparator>::ConstIterator E(_p->variant_map.find(p_key));
-	if (!E) {
+	int64_t pos = _p->find(p_key);
+	if (pos < 0) {
 		return nullptr;
 	}
-	return &E->value;
+	return &_p->get_entry(pos).value;
 }
 
 Variant *Dictionary::getptr(const Variant &p_key) {
-	HashMap<Variant, Variant, VariantHasher, StringLikeVariantComparator>::Iterator E(_p->variant_map.find(p_key));
-	if (!E) {
+	int64_t pos = _p->find(p_key);
+	if (pos < 0) {
 		return nullptr;
 	}
 	if (unlikely(_p->read_only != nullptr)) {
-		*_p->read_only = E->value;
+		*_p->read_only = _p->get_entry(pos).value;
 		return _p->read_only;
 	} else {
-		return &E->value;
+		return &_p->get_entry(pos).value;
 	}
 }
 
 Variant Dictionary::get_valid(const Variant &p_key) const {
-	HashMap<Variant, Variant, VariantHasher, StringLikeVariantComparator>::ConstIterator E(_p->variant_map.find(p_key));
+	int64_t pos = _p->find(p_key);
 
-	if (!E) {
+	if (pos < 0) {
 		return Variant();
 	}
-	return E->value;
+	return _p->get_entry(pos).value;
 }
 
 Variant Dictionary::get(const Variant &p_key, const Variant &p_default) const {
@@ -151,15 +471,15 @@ Variant Dictionary::get(const Variant &p_key, const Variant &p_default) const {
 }
 
 int Dictionary::size() const {
-	return _p->variant_map.size();
+	return _p->size();
 }
 
 bool Dictionary::is_empty() const {
-	return !_p->variant_map.size();
+	return !_p->size();
 }
 
 bool Dictionary::has(const Variant &p_key) const {
-	return _p->variant_map.has(p_key);
+	return _p->find(p_key) >= 0;
 }
 
 bool Dictionary::has_all(const Array &p_keys) const {
@@ -172,7 +492,7 @@ bool Dictionary::has_all(const Array &p_keys) const {
 }
 
 Variant Dictionary::find_key(const Variant &p_value) const {
-	for (const KeyValue<Variant, Variant> &E : _p->variant_map) {
+	for (const DictionaryPrivate::Entry &E : *_p) {
 		if (E.value == p_value) {
 			return E.key;
 		}
@@ -182,7 +502,12 @@ Variant Dictionary::find_key(const Variant &p_value) const {
 
 bool Dictionary::erase(const Variant &p_key) {
 	ERR_FAIL_COND_V_MSG(_p->read_only, false, "Dictionary is in read-only state.");
-	return _p->variant_map.erase(p_key);
+	int64_t pos = _p->find(p_key);
+	if (pos < 0) {
+		return false;
+	}
+	_p->erase_at(pos);
+	return true;
 }
 
 bool Dictionary::operator==(const Dictionary &p_dictionary) const {
@@ -198,7 +523,7 @@ bool Dictionary::recursive_equal(const Dictionary &p_dictionary, int recursion_c
 	if (_p == p_dictionary._p) {
 		return true;
 	}
-	if (_p->variant_map.size() != p_dictionary._p->variant_map.size()) {
+	if (_p->size() != p_dictionary._p->size()) {
 		return false;
 	}
 
@@ -208,9 +533,9 @@ bool Dictionary::recursive_equal(const Dictionary &p_dictionary, int recursion_c
 		return true;
 	}
 	recursion_count++;
-	for (const KeyValue<Variant, Variant> &this_E : _p->variant_map) {
-		HashMap<Variant, Variant, VariantHasher, StringLikeVariantComparator>::ConstIterator other_E(p_dictionary._p->variant_map.find(this_E.key));
-		if (!other_E || !this_E.value.hash_compare(other_E->value, recursion_count, false)) {
+	for (const DictionaryPrivate::Entry &this_E : *_p) {
+		int64_t other_pos = p_dictionary._p->find(this_E.key);
+		if (other_pos < 0 || !this_E.value.hash_compare(p_dictionary._p->get_entry(other_pos).value, recursion_count, false)) {
 			return false;
 		}
 	}
@@ -236,11 +561,11 @@ void Dictionary::_ref(const Dictionary &p_from) const {
 
 void Dictionary::clear() {
 	ERR_FAIL_COND_MSG(_p->read_only, "Dictionary is in read-only state.");
-	_p->variant_map.clear();
+	_p->clear();
 }
 
 void Dictionary::merge(const Dictionary &p_dictionary, bool p_overwrite) {
-	for (const KeyValue<Variant, Variant> &E : p_dictionary._p->variant_map) {
+	for (const DictionaryPrivate::Entry &E : *p_dictionary._p) {
 		if (p_overwrite || !has(E.key)) {
 			this->operator[](E.key) = E.value;
 		}
@@ -271,7 +596,7 @@ uint32_t Dictionary::recursive_hash(int recursion_count) const {
 	uint32_t h = hash_murmur3_one_32(Variant::DICTIONARY);
 
 	recursion_count++;
-	for (const KeyValue<Variant, Variant> &E : _p->variant_map) {
+	for (const DictionaryPrivate::Entry &E : *_p) {
 		h = hash_murmur3_one_32(E.key.recursive_hash(recursion_count), h);
 		h = hash_murmur3_one_32(E.value.recursive_hash(recursion_count), h);
 	}
@@ -281,14 +606,14 @@ uint32_t Dictionary::recursive_hash(int recursion_count) const {
 
 Array Dictionary::keys() const {
 	Array varr;
-	if (_p->variant_map.is_empty()) {
+	if (_p->size() == 0) {
 		return varr;
 	}
 
 	varr.resize(size());
 
 	int i = 0;
-	for (const KeyValue<Variant, Variant> &E : _p->variant_map) {
+	for (const DictionaryPrivate::Entry &E : *_p) {
 		varr[i] = E.key;
 		i++;
 	}
@@ -298,14 +623,14 @@ Array Dictionary::keys() const {
 
 Array Dictionary::values() const {
 	Array varr;
-	if (_p->variant_map.is_empty()) {
+	if (_p->size() == 0) {
 		return varr;
 	}
 
 	varr.resize(size());
 
 	int i = 0;
-	for (const KeyValue<Variant, Variant> &E : _p->variant_map) {
+	for (const DictionaryPrivate::Entry &E : *_p) {
 		varr[i] = E.value;
 		i++;
 	}
@@ -316,20 +641,22 @@ Array Dictionary::values() const {
 const Variant *Dictionary::next(const Variant *p_key) const {
 	if (p_key == nullptr) {
 		// caller wants to get the first element
-		if (_p->variant_map.begin()) {
-			return &_p->variant_map.begin()->key;
+		DictionaryPrivate::ConstIterator E = _p->begin();
+		if (E != _p->end()) {
+			return &E->key;
 		}
 		return nullptr;
 	}
-	HashMap<Variant, Variant, VariantHasher, StringLikeVariantComparator>::Iterator E = _p->variant_map.find(*p_key);
+	int64_t pos = _p->find(*p_key);
 
-	if (!E) {
+	if (pos < 0) {
 		return nullptr;
 	}
 
+	DictionaryPrivate::ConstIterator E = { _p, (uint32_t)pos };
 	++E;
 
-	if (E) {
+	if (E != _p->end()) {
 		return &E->key;
 	}
 
@@ -359,11 +686,11 @@ Dictionary Dictionary::recursive_duplicate(bool p_deep, int recursion_count) con
 
 	if (p_deep) {
 		recursion_count++;
-		for (const KeyValue<Variant, Variant> &E : _p->variant_map) {
+		for (const DictionaryPrivate::Entry &E : *_p) {
 			n[E.key.recursive_duplicate(true, recursion_count)] = E.value.recursive_duplicate(true, recursion_count);
 		}
 	} else {
-		for (const KeyValue<Variant, Variant> &E : _p->variant_map) {
+		for (const DictionaryPrivate::Entry &E : *_p) {
 			n[E.key] = E.value;
 		}
 	}
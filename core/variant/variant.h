@@ -64,6 +64,7 @@ class Object;
 
 struct PropertyInfo;
 struct MethodInfo;
+struct VariantBuiltInMethodInfo;
 
 typedef Vector<uint8_t> PackedByteArray;
 typedef Vector<int32_t> PackedInt32Array;
@@ -584,6 +585,12 @@ public:
 	static int get_builtin_method_count(Variant::Type p_type);
 	static uint32_t get_builtin_method_hash(Variant::Type p_type, const StringName &p_method);
 
+	// Built-in method resolved once, so it can be cached and called without being looked up by name again.
+	typedef const VariantBuiltInMethodInfo *BuiltInMethod;
+	static BuiltInMethod get_builtin_method(Variant::Type p_type, const StringName &p_method);
+	static bool is_builtin_method_const(BuiltInMethod p_method);
+	void call_builtin_method(BuiltInMethod p_method, const Variant **p_args, int p_argcount, Variant &r_ret, Callable::CallError &r_error);
+
 	void callp(const StringName &p_method, const Variant **p_args, int p_argcount, Variant &r_ret, Callable::CallError &r_error);
 
 	template <typename... VarArgs>
@@ -1111,6 +1111,7 @@ struct VariantBuiltInMethodInfo {
 	bool is_static = false;
 	bool has_return_type = false;
 	bool is_vararg = false;
+	Variant::Type base_type = Variant::NIL;
 	Variant::Type return_type;
 	int argument_count = 0;
 	Variant::Type (*get_argument_type)(int p_arg) = nullptr;
@@ -1138,6 +1139,7 @@ static void register_builtin_method(const Vector<String> &p_argnames, const Vect
 	imi.is_const = T::is_const();
 	imi.is_static = T::is_static();
 	imi.is_vararg = T::is_vararg();
+	imi.base_type = T::get_base_type();
 	imi.has_return_type = T::has_return_type();
 	imi.return_type = T::get_return_type();
 	imi.argument_count = T::get_argument_count();
@@ -1236,6 +1238,27 @@ void Variant::call_static(Variant::Type p_type, const StringName &p_method, cons
 	imf->call(nullptr, p_args, p_argcount, r_ret, imf->default_arguments, r_error);
 }
 
+Variant::BuiltInMethod Variant::get_builtin_method(Variant::Type p_type, const StringName &p_method) {
+	ERR_FAIL_INDEX_V(p_type, Variant::VARIANT_MAX, nullptr);
+	// Methods are all registered on startup, so the pointers into the map stay valid after that.
+	return builtin_method_info[p_type].lookup_ptr(p_method);
+}
+
+bool Variant::is_builtin_method_const(BuiltInMethod p_method) {
+	ERR_FAIL_NULL_V(p_method, false);
+	return p_method->is_const;
+}
+
+void Variant::call_builtin_method(BuiltInMethod p_method, const Variant **p_args, int p_argcount, Variant &r_ret, Callable::CallError &r_error) {
+	if (unlikely(!p_method || p_method->base_type != type)) {
+		r_error.error = Callable::CallError::CALL_ERROR_INVALID_METHOD;
+		return;
+	}
+
+	r_error.error = Callable::CallError::CALL_OK;
+	p_method->call(this, p_args, p_argcount, r_ret, p_method->default_arguments, r_error);
+}
+
 bool Variant::has_method(const StringName &p_method) const {
 	if (type == OBJECT) {
 		Object *obj = get_validated_object();
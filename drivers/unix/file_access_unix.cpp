@@ -37,6 +37,7 @@
 
 #include <errno.h>
 #include <fcntl.h>
+#include <sys/mman.h>
 #include <sys/stat.h>
 #include <sys/types.h>
 #include <unistd.h>
@@ -142,6 +143,12 @@ void FileAccessUnix::_close() {
 		return;
 	}
 
+	if (mapped) {
+		munmap(mapped, mapped_length);
+		mapped = nullptr;
+		mapped_length = 0;
+	}
+
 	fclose(f);
 	f = nullptr;
 
@@ -237,6 +244,29 @@ uint64_t FileAccessUnix::get_buffer(uint8_t *p_dst, uint64_t p_length) const {
 	return read;
 }
 
+const uint8_t *FileAccessUnix::map_read_only() {
+	ERR_FAIL_NULL_V_MSG(f, nullptr, "File must be opened before use.");
+	if (flags != READ) {
+		return nullptr;
+	}
+	if (mapped) {
+		return (const uint8_t *)mapped;
+	}
+
+	struct stat st = {};
+	if (fstat(fileno(f), &st) != 0 || st.st_size <= 0) {
+		return nullptr;
+	}
+
+	void *data = mmap(nullptr, st.st_size, PROT_READ, MAP_PRIVATE, fileno(f), 0);
+	if (data == MAP_FAILED) {
+		return nullptr;
+	}
+	mapped = data;
+	mapped_length = st.st_size;
+	return (const uint8_t *)mapped;
+}
+
 Error FileAccessUnix::get_error() const {
 	return last_error;
 }
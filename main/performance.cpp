@@ -85,6 +85,9 @@ void Performance::_bind_methods() {
 	BIND_ENUM_CONSTANT(NAVIGATION_EDGE_MERGE_COUNT);
 	BIND_ENUM_CONSTANT(NAVIGATION_EDGE_CONNECTION_COUNT);
 	BIND_ENUM_CONSTANT(NAVIGATION_EDGE_FREE_COUNT);
+	BIND_ENUM_CONSTANT(TIME_PROCESS_GROUP_MAX);
+	BIND_ENUM_CONSTANT(TIME_PHYSICS_PROCESS_GROUP_MAX);
+	BIND_ENUM_CONSTANT(NAVIGATION_PATH_QUERY_COUNT);
 	BIND_ENUM_CONSTANT(MONITOR_MAX);
 }
 
@@ -97,6 +100,15 @@ int Performance::_get_node_count() const {
 	return sml->get_node_count();
 }
 
+double Performance::_get_process_group_time_max(bool p_physics) const {
+	MainLoop *ml = OS::get_singleton()->get_main_loop();
+	SceneTree *sml = Object::cast_to<SceneTree>(ml);
+	if (!sml) {
+		return 0;
+	}
+	return USEC_TO_SEC(sml->get_process_group_time_max_usec(p_physics));
+}
+
 String Performance::get_monitor_name(Monitor p_monitor) const {
 	ERR_FAIL_INDEX_V(p_monitor, MONITOR_MAX, String());
 	static const char *names[MONITOR_MAX] = {
@@ -133,6 +145,9 @@ String Performance::get_monitor_name(Monitor p_monitor) const {
 		"navigation/edges_merged",
 		"navigation/edges_connected",
 		"navigation/edges_free",
+		"time/process_group_max",
+		"time/physics_process_group_max",
+		"navigation/path_queries",
 
 	};
 
@@ -207,6 +222,12 @@ double Performance::get_monitor(Monitor p_monitor) const {
 			return NavigationServer3D::get_singleton()->get_process_info(NavigationServer3D::INFO_EDGE_CONNECTION_COUNT);
 		case NAVIGATION_EDGE_FREE_COUNT:
 			return NavigationServer3D::get_singleton()->get_process_info(NavigationServer3D::INFO_EDGE_FREE_COUNT);
+		case TIME_PROCESS_GROUP_MAX:
+			return _get_process_group_time_max(false);
+		case TIME_PHYSICS_PROCESS_GROUP_MAX:
+			return _get_process_group_time_max(true);
+		case NAVIGATION_PATH_QUERY_COUNT:
+			return NavigationServer3D::get_singleton()->get_process_info(NavigationServer3D::INFO_PATH_QUERY_COUNT);
 
 		default: {
 		}
@@ -252,6 +273,9 @@ Performance::MonitorType Performance::get_monitor_type(Monitor p_monitor) const
 		MONITOR_TYPE_QUANTITY,
 		MONITOR_TYPE_QUANTITY,
 		MONITOR_TYPE_QUANTITY,
+		MONITOR_TYPE_TIME,
+		MONITOR_TYPE_TIME,
+		MONITOR_TYPE_QUANTITY,
 
 	};
 
@@ -47,6 +47,7 @@ class Performance : public Object {
 	static void _bind_methods();
 
 	int _get_node_count() const;
+	double _get_process_group_time_max(bool p_physics) const;
 
 	double _process_time;
 	double _physics_process_time;
@@ -100,6 +101,9 @@ public:
 		NAVIGATION_EDGE_MERGE_COUNT,
 		NAVIGATION_EDGE_CONNECTION_COUNT,
 		NAVIGATION_EDGE_FREE_COUNT,
+		TIME_PROCESS_GROUP_MAX,
+		TIME_PHYSICS_PROCESS_GROUP_MAX,
+		NAVIGATION_PATH_QUERY_COUNT,
 		MONITOR_MAX
 	};
 
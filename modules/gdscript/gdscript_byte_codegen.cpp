@@ -592,6 +592,37 @@ void GDScriptByteCodeGenerator::write_binary_operator(const Address &p_target, V
 			}
 		}
 
+		// Common operations on int and float get dedicated opcodes, saving the call to the evaluator.
+		Variant::Type left_type = p_left_operand.type.builtin_type;
+		if (left_type == p_right_operand.type.builtin_type && (left_type == Variant::INT || left_type == Variant::FLOAT)) {
+			bool is_int = left_type == Variant::INT;
+			int typed_opcode = -1;
+			switch (p_operator) {
+				case Variant::OP_ADD:
+					typed_opcode = is_int ? GDScriptFunction::OPCODE_OPERATOR_ADD_INT : GDScriptFunction::OPCODE_OPERATOR_ADD_FLOAT;
+					break;
+				case Variant::OP_SUBTRACT:
+					typed_opcode = is_int ? GDScriptFunction::OPCODE_OPERATOR_SUBTRACT_INT : GDScriptFunction::OPCODE_OPERATOR_SUBTRACT_FLOAT;
+					break;
+				case Variant::OP_MULTIPLY:
+					typed_opcode = is_int ? GDScriptFunction::OPCODE_OPERATOR_MULTIPLY_INT : GDScriptFunction::OPCODE_OPERATOR_MULTIPLY_FLOAT;
+					break;
+				case Variant::OP_LESS:
+					typed_opcode = is_int ? GDScriptFunction::OPCODE_OPERATOR_LESS_INT : GDScriptFunction::OPCODE_OPERATOR_LESS_FLOAT;
+					break;
+				default:
+					break;
+			}
+
+			if (typed_opcode != -1) {
+				append_opcode((GDScriptFunction::Opcode)typed_opcode);
+				append(p_left_operand);
+				append(p_right_operand);
+				append(p_target);
+				return;
+			}
+		}
+
 		// Gather specific operator.
 		Variant::ValidatedOperatorEvaluator op_func = Variant::get_validated_operator_evaluator(p_operator, p_left_operand.type.builtin_type, p_right_operand.type.builtin_type);
 
@@ -847,6 +878,10 @@ void GDScriptByteCodeGenerator::write_get_named(const Address &p_target, const S
 	append(p_source);
 	append(p_target);
 	append(p_name);
+	constexpr int _pointer_size = sizeof(MethodBind *) / sizeof(*(opcodes.ptr()));
+	for (int i = 0; i < 2 * _pointer_size; i++) {
+		append(0); // Space for the inline cache (class and getter).
+	}
 }
 
 void GDScriptByteCodeGenerator::write_set_member(const Address &p_value, const StringName &p_name) {
@@ -141,6 +141,28 @@ void GDScriptFunction::disassemble(const Vector<String> &p_code_lines) const {
 
 				incr += 5;
 			} break;
+
+#define DISASSEMBLE_OPERATOR_TYPED(m_op, m_type, m_operator_name) \
+	case OPCODE_OPERATOR_##m_op##_##m_type: {                     \
+		text += "validated operator ";                            \
+		text += DADDR(3);                                         \
+		text += " = ";                                            \
+		text += DADDR(1);                                         \
+		text += " " m_operator_name " ";                          \
+		text += DADDR(2);                                         \
+		text += " (" #m_type ")";                                 \
+		incr += 4;                                                \
+	} break
+
+				DISASSEMBLE_OPERATOR_TYPED(ADD, INT, "+");
+				DISASSEMBLE_OPERATOR_TYPED(SUBTRACT, INT, "-");
+				DISASSEMBLE_OPERATOR_TYPED(MULTIPLY, INT, "*");
+				DISASSEMBLE_OPERATOR_TYPED(LESS, INT, "<");
+				DISASSEMBLE_OPERATOR_TYPED(ADD, FLOAT, "+");
+				DISASSEMBLE_OPERATOR_TYPED(SUBTRACT, FLOAT, "-");
+				DISASSEMBLE_OPERATOR_TYPED(MULTIPLY, FLOAT, "*");
+				DISASSEMBLE_OPERATOR_TYPED(LESS, FLOAT, "<");
+
 			case OPCODE_TYPE_TEST_BUILTIN: {
 				text += "type test ";
 				text += DADDR(1);
@@ -280,6 +302,7 @@ void GDScriptFunction::disassemble(const Vector<String> &p_code_lines) const {
 				incr += 4;
 			} break;
 			case OPCODE_GET_NAMED: {
+				constexpr int _pointer_size = sizeof(MethodBind *) / sizeof(*_code_ptr);
 				text += "get_named ";
 				text += DADDR(2);
 				text += " = ";
@@ -288,7 +311,7 @@ void GDScriptFunction::disassemble(const Vector<String> &p_code_lines) const {
 				text += _global_names_ptr[_code_ptr[ip + 3]];
 				text += "\"]";
 
-				incr += 4;
+				incr += 4 + 2 * _pointer_size;
 			} break;
 			case OPCODE_GET_NAMED_VALIDATED: {
 				text += "get_named validated ";
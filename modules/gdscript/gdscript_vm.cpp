@@ -191,6 +191,14 @@ void (*type_init_function_table[])(Variant *) = {
 	static const void *switch_table_ops[] = {          \
 		&&OPCODE_OPERATOR,                             \
 		&&OPCODE_OPERATOR_VALIDATED,                   \
+		&&OPCODE_OPERATOR_ADD_INT,                     \
+		&&OPCODE_OPERATOR_SUBTRACT_INT,                \
+		&&OPCODE_OPERATOR_MULTIPLY_INT,                \
+		&&OPCODE_OPERATOR_LESS_INT,                    \
+		&&OPCODE_OPERATOR_ADD_FLOAT,                   \
+		&&OPCODE_OPERATOR_SUBTRACT_FLOAT,              \
+		&&OPCODE_OPERATOR_MULTIPLY_FLOAT,              \
+		&&OPCODE_OPERATOR_LESS_FLOAT,                  \
 		&&OPCODE_TYPE_TEST_BUILTIN,                    \
 		&&OPCODE_TYPE_TEST_ARRAY,                      \
 		&&OPCODE_TYPE_TEST_NATIVE,                     \
@@ -751,6 +759,26 @@ Variant GDScriptFunction::call(GDScriptInstance *p_instance, const Variant **p_a
 			}
 			DISPATCH_OPCODE;
 
+#define OPCODE_OPERATOR_TYPED(m_op, m_operator, m_type, m_ret_type)                                                                        \
+	OPCODE(OPCODE_OPERATOR_##m_op##_##m_type) {                                                                                            \
+		CHECK_SPACE(4);                                                                                                                    \
+		GET_VARIANT_PTR(a, 0);                                                                                                             \
+		GET_VARIANT_PTR(b, 1);                                                                                                             \
+		GET_VARIANT_PTR(dst, 2);                                                                                                           \
+		*VariantInternal::OP_GET_##m_ret_type(dst) = *VariantInternal::OP_GET_##m_type(a) m_operator *VariantInternal::OP_GET_##m_type(b); \
+		ip += 4;                                                                                                                           \
+	}                                                                                                                                      \
+	DISPATCH_OPCODE
+
+			OPCODE_OPERATOR_TYPED(ADD, +, INT, INT);
+			OPCODE_OPERATOR_TYPED(SUBTRACT, -, INT, INT);
+			OPCODE_OPERATOR_TYPED(MULTIPLY, *, INT, INT);
+			OPCODE_OPERATOR_TYPED(LESS, <, INT, BOOL);
+			OPCODE_OPERATOR_TYPED(ADD, +, FLOAT, FLOAT);
+			OPCODE_OPERATOR_TYPED(SUBTRACT, -, FLOAT, FLOAT);
+			OPCODE_OPERATOR_TYPED(MULTIPLY, *, FLOAT, FLOAT);
+			OPCODE_OPERATOR_TYPED(LESS, <, FLOAT, BOOL);
+
 			OPCODE(OPCODE_TYPE_TEST_BUILTIN) {
 				CHECK_SPACE(4);
 
@@ -1090,7 +1118,8 @@ Variant GDScriptFunction::call(GDScriptInstance *p_instance, const Variant **p_a
 			DISPATCH_OPCODE;
 
 			OPCODE(OPCODE_GET_NAMED) {
-				CHECK_SPACE(4);
+				constexpr int _pointer_size = sizeof(MethodBind *) / sizeof(*_code_ptr);
+				CHECK_SPACE(4 + 2 * _pointer_size);
 
 				GET_VARIANT_PTR(src, 0);
 				GET_VARIANT_PTR(dst, 1);
@@ -1100,22 +1129,54 @@ Variant GDScriptFunction::call(GDScriptInstance *p_instance, const Variant **p_a
 				GD_ERR_BREAK(indexname < 0 || indexname >= _global_names_count);
 				const StringName *index = &_global_names_ptr[indexname];
 
-				bool valid;
+				// Inline cache of the native getter, keyed on the class of the first object seen here.
+				// Objects with a script resolve properties on their own first, so they always take the slow path.
+				MethodBind *cached_getter = nullptr;
+				Object *src_obj = src->get_type() == Variant::OBJECT ? src->get_validated_object() : nullptr;
+				if (src_obj && !src_obj->get_script_instance()) {
+					const void *class_key = src_obj->get_class_name().data_unique_pointer();
+					const void **cache_key = reinterpret_cast<const void **>(&_code_ptr[ip + 4]);
+					MethodBind **cache_getter = reinterpret_cast<MethodBind **>(&_code_ptr[ip + 4 + _pointer_size]);
+
+					// Check if this is the first run. If so, store the getter for this class.
+					if (unlikely(*cache_key == nullptr)) {
+						static Mutex initializer_mutex;
+						initializer_mutex.lock();
+						// Check again in case another thread already set it.
+						if (*cache_key == nullptr) {
+							// Stored even if there is no getter, so the lookup isn't repeated on every run.
+							*cache_getter = ClassDB::get_property_getter_bind(src_obj->get_class_name(), *index);
+							*cache_key = class_key;
+						}
+						initializer_mutex.unlock();
+					}
+
+					if (likely(*cache_key == class_key)) {
+						cached_getter = *cache_getter;
+					}
+				}
+
+				if (cached_getter) {
+					Callable::CallError ce;
+					*dst = cached_getter->call(src_obj, nullptr, 0, ce);
+				} else {
+					bool valid;
 #ifdef DEBUG_ENABLED
-				//allow better error message in cases where src and dst are the same stack position
-				Variant ret = src->get_named(*index, valid);
+					//allow better error message in cases where src and dst are the same stack position
+					Variant ret = src->get_named(*index, valid);
 
 #else
-				*dst = src->get_named(*index, valid);
+					*dst = src->get_named(*index, valid);
 #endif
 #ifdef DEBUG_ENABLED
-				if (!valid) {
-					err_text = "Invalid get index '" + index->operator String() + "' (on base: '" + _get_var_type(src) + "').";
-					OPCODE_BREAK;
-				}
-				*dst = ret;
+					if (!valid) {
+						err_text = "Invalid get index '" + index->operator String() + "' (on base: '" + _get_var_type(src) + "').";
+						OPCODE_BREAK;
+					}
+					*dst = ret;
 #endif
-				ip += 4;
+				}
+				ip += 4 + 2 * _pointer_size;
 			}
 			DISPATCH_OPCODE;
 
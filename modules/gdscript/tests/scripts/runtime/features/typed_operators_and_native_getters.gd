@@ -0,0 +1,40 @@
+class ScriptedResource extends Resource:
+	func _get(property):
+		if property == &"resource_name":
+			return "scripted"
+		return null
+
+func get_resource_name(resource):
+	return resource.resource_name
+
+func get_name_method(resource):
+	return resource.get_name
+
+func test():
+	var i: int = 7
+	var j: int = 3
+	print(i + j, " ", i - j, " ", i * j, " ", i < j)
+
+	var x: float = 1.5
+	var y: float = 0.25
+	print(x + y, " ", x - y, " ", x * y, " ", y < x)
+
+	var sum: int = 0
+	var k: int = 0
+	while k < 10:
+		sum += k * k
+		k = k + 1
+	print(sum)
+
+	var plain := Resource.new()
+	plain.resource_name = "plain"
+	var gradient := Gradient.new()
+	gradient.resource_name = "gradient"
+	var scripted := ScriptedResource.new()
+
+	# The same access site sees several classes, and objects with a script.
+	for resource in [plain, gradient, scripted, plain]:
+		print(get_resource_name(resource))
+
+	# Methods aren't mistaken for properties.
+	print(get_name_method(plain) is Callable)
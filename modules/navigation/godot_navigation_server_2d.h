@@ -64,6 +64,8 @@ public:
 	virtual real_t map_get_cell_size(RID p_map) const override;
 	virtual void map_set_use_edge_connections(RID p_map, bool p_enabled) override;
 	virtual bool map_get_use_edge_connections(RID p_map) const override;
+	virtual void map_set_use_hierarchical_pathfinding(RID p_map, bool p_enabled) override;
+	virtual bool map_get_use_hierarchical_pathfinding(RID p_map) const override;
 	virtual void map_set_edge_connection_margin(RID p_map, real_t p_connection_margin) override;
 	virtual real_t map_get_edge_connection_margin(RID p_map) const override;
 	virtual void map_set_link_connection_radius(RID p_map, real_t p_connection_radius) override;
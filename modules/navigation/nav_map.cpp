@@ -37,6 +37,7 @@
 
 #include "core/config/project_settings.h"
 #include "core/object/worker_thread_pool.h"
+#include "core/templates/sort_array.h"
 
 #include <Obstacle2d.h>
 
@@ -86,6 +87,14 @@ void NavMap::set_use_edge_connections(bool p_enabled) {
 	regenerate_links = true;
 }
 
+void NavMap::set_use_hierarchical_pathfinding(bool p_enabled) {
+	if (use_hierarchical_pathfinding == p_enabled) {
+		return;
+	}
+	use_hierarchical_pathfinding = p_enabled;
+	hierarchical_graph_valid = false;
+}
+
 void NavMap::set_edge_connection_margin(real_t p_edge_connection_margin) {
 	if (edge_connection_margin == p_edge_connection_margin) {
 		return;
@@ -115,8 +124,40 @@ gd::PointKey NavMap::get_point_key(const Vector3 &p_pos) const {
 	return p;
 }
 
+struct NavMapHierarchicalOpenEntry {
+	uint32_t node = 0;
+	real_t cost = 0.0; // Cost to reach the node.
+	real_t estimate = 0.0; // Cost plus the heuristic.
+};
+
+struct NavMapHierarchicalOpenEntryComparator {
+	_FORCE_INLINE_ bool operator()(const NavMapHierarchicalOpenEntry &p_a, const NavMapHierarchicalOpenEntry &p_b) const {
+		return p_a.estimate > p_b.estimate;
+	}
+};
+
+// Buffers of the A* search, kept per thread so that path queries don't allocate for every search.
+struct NavMapPathQueryScratch {
+	LocalVector<gd::NavigationPoly> navigation_polys;
+	LocalVector<uint32_t> to_visit;
+
+	// Hierarchical search.
+	LocalVector<real_t> cluster_costs;
+	LocalVector<real_t> node_costs;
+	LocalVector<real_t> node_goal_costs;
+	LocalVector<int32_t> node_parents;
+	LocalVector<NavMapHierarchicalOpenEntry> open_heap;
+	// Clusters stamped with the current pass are part of the corridor.
+	LocalVector<uint32_t> corridor;
+	uint32_t corridor_pass = 0;
+};
+
+static thread_local NavMapPathQueryScratch path_query_scratch;
+
 Vector<Vector3> NavMap::get_path(Vector3 p_origin, Vector3 p_destination, bool p_optimize, uint32_t p_navigation_layers, Vector<int32_t> *r_path_types, TypedArray<RID> *r_path_rids, Vector<int64_t> *r_path_owners) const {
 	ERR_FAIL_COND_V_MSG(map_update_id == 0, Vector<Vector3>(), "NavigationServer map query failed because it was made before first map synchronization.");
+	path_query_count.increment();
+
 	// Clear metadata outputs.
 	if (r_path_types) {
 		r_path_types->clear();
@@ -194,8 +235,14 @@ Vector<Vector3> NavMap::get_path(Vector3 p_origin, Vector3 p_destination, bool p
 		return path;
 	}
 
+	// Restrict the search to the clusters on the hierarchical route, if there is one.
+	bool use_corridor = hierarchical_graph_valid && hierarchical_polygon_clusters[_get_hierarchical_polygon_index(begin_poly)] != hierarchical_polygon_clusters[_get_hierarchical_polygon_index(end_poly)] && _find_hierarchical_corridor(begin_poly, end_poly, end_point, p_navigation_layers);
+	const LocalVector<uint32_t> &corridor = path_query_scratch.corridor;
+	const uint32_t corridor_pass = path_query_scratch.corridor_pass;
+
 	// List of all reachable navigation polys.
-	LocalVector<gd::NavigationPoly> navigation_polys;
+	LocalVector<gd::NavigationPoly> &navigation_polys = path_query_scratch.navigation_polys;
+	navigation_polys.clear();
 	navigation_polys.reserve(polygons.size() * 0.75);
 
 	// Add the start polygon to the reachable navigation polygons.
@@ -207,7 +254,8 @@ Vector<Vector3> NavMap::get_path(Vector3 p_origin, Vector3 p_destination, bool p
 	navigation_polys.push_back(begin_navigation_poly);
 
 	// List of polygon IDs to visit.
-	List<uint32_t> to_visit;
+	LocalVector<uint32_t> &to_visit = path_query_scratch.to_visit;
+	to_visit.clear();
 	to_visit.push_back(0);
 
 	// This is an implementation of the A* algorithm.
@@ -231,6 +279,10 @@ Vector<Vector3> NavMap::get_path(Vector3 p_origin, Vector3 p_destination, bool p
 					continue;
 				}
 
+				if (use_corridor && corridor[hierarchical_polygon_clusters[_get_hierarchical_polygon_index(connection.polygon)]] != corridor_pass) {
+					continue;
+				}
+
 				const gd::NavigationPoly &least_cost_poly = navigation_polys[least_cost_id];
 				real_t poly_enter_cost = 0.0;
 				real_t poly_travel_cost = least_cost_poly.poly->owner->get_travel_cost();
@@ -280,6 +332,23 @@ Vector<Vector3> NavMap::get_path(Vector3 p_origin, Vector3 p_destination, bool p
 
 		// When the list of polygons to visit is empty at this point it means the End Polygon is not reachable
 		if (to_visit.size() == 0) {
+			if (use_corridor) {
+				// The exact route leaves the corridor, search the whole map instead.
+				use_corridor = false;
+				gd::NavigationPoly np = navigation_polys[0];
+				navigation_polys.clear();
+				navigation_polys.push_back(np);
+				to_visit.clear();
+				to_visit.push_back(0);
+				least_cost_id = 0;
+				prev_least_cost_id = -1;
+
+				reachable_end = nullptr;
+				reachable_d = FLT_MAX;
+
+				continue;
+			}
+
 			// Thus use the further reachable polygon
 			ERR_BREAK_MSG(is_reachable == false, "It's not expect to not find the most reachable polygons");
 			is_reachable = false;
@@ -358,8 +427,8 @@ Vector<Vector3> NavMap::get_path(Vector3 p_origin, Vector3 p_destination, bool p
 		// Find the polygon with the minimum cost from the list of polygons to visit.
 		least_cost_id = -1;
 		real_t least_cost = FLT_MAX;
-		for (List<uint32_t>::Element *element = to_visit.front(); element != nullptr; element = element->next()) {
-			gd::NavigationPoly *np = &navigation_polys[element->get()];
+		for (uint32_t id : to_visit) {
+			gd::NavigationPoly *np = &navigation_polys[id];
 			real_t cost = np->traveled_distance;
 			cost += (np->entry.distance_to(end_point) * np->poly->owner->get_travel_cost());
 			if (cost < least_cost) {
@@ -575,6 +644,139 @@ Vector<Vector3> NavMap::get_path(Vector3 p_origin, Vector3 p_destination, bool p
 	return path;
 }
 
+uint32_t NavMap::_get_hierarchical_polygon_index(const gd::Polygon *p_polygon) const {
+	if (p_polygon >= polygons.ptr() && p_polygon < polygons.ptr() + polygons.size()) {
+		return p_polygon - polygons.ptr();
+	}
+	return polygons.size() + (p_polygon - link_polygons.ptr());
+}
+
+bool NavMap::_find_hierarchical_corridor(const gd::Polygon *p_begin_poly, const gd::Polygon *p_end_poly, const Vector3 &p_end_point, uint32_t p_navigation_layers) const {
+	NavMapPathQueryScratch &scratch = path_query_scratch;
+
+	const uint32_t begin_polygon_index = _get_hierarchical_polygon_index(p_begin_poly);
+	const uint32_t end_polygon_index = _get_hierarchical_polygon_index(p_end_poly);
+	const uint32_t begin_cluster_id = hierarchical_polygon_clusters[begin_polygon_index];
+	const uint32_t end_cluster_id = hierarchical_polygon_clusters[end_polygon_index];
+	const HierarchicalCluster &begin_cluster = hierarchical_clusters[begin_cluster_id];
+	const HierarchicalCluster &end_cluster = hierarchical_clusters[end_cluster_id];
+	ERR_FAIL_NULL_V(begin_cluster.region, false);
+	ERR_FAIL_NULL_V(end_cluster.region, false);
+
+	const uint32_t node_count = hierarchical_nodes.size();
+	scratch.node_costs.resize(node_count);
+	scratch.node_goal_costs.resize(node_count);
+	scratch.node_parents.resize(node_count);
+	for (uint32_t i = 0; i < node_count; i++) {
+		scratch.node_costs[i] = FLT_MAX;
+		scratch.node_parents[i] = -1;
+	}
+
+	// Keep the heuristic admissible with regions or links cheaper to travel than the default.
+	real_t min_travel_cost = FLT_MAX;
+	for (const NavRegion *region : regions) {
+		if (region->get_enabled()) {
+			min_travel_cost = MIN(min_travel_cost, region->get_travel_cost());
+		}
+	}
+	for (const NavLink *link : links) {
+		min_travel_cost = MIN(min_travel_cost, link->get_travel_cost());
+	}
+
+	SortArray<NavMapHierarchicalOpenEntry, NavMapHierarchicalOpenEntryComparator> heap_sort;
+	LocalVector<NavMapHierarchicalOpenEntry> &open_heap = scratch.open_heap;
+	open_heap.clear();
+
+	// The route can end at any node of the end cluster, plus the cost to reach the end polygon from there.
+	// Both searches stay inside a single cluster, so their cost is bounded regardless of the region size.
+	end_cluster.region->get_cluster_costs(end_polygon_index - end_cluster.polygon_offset, scratch.cluster_costs);
+	for (uint32_t node_id : end_cluster.nodes) {
+		const real_t cost = scratch.cluster_costs[hierarchical_nodes[node_id].cluster_index];
+		scratch.node_goal_costs[node_id] = cost == FLT_MAX ? FLT_MAX : cost * end_cluster.owner->get_travel_cost();
+	}
+
+	// Start from the nodes of the begin cluster.
+	begin_cluster.region->get_cluster_costs(begin_polygon_index - begin_cluster.polygon_offset, scratch.cluster_costs);
+	for (uint32_t node_id : begin_cluster.nodes) {
+		const real_t cost = scratch.cluster_costs[hierarchical_nodes[node_id].cluster_index];
+		if (cost == FLT_MAX) {
+			continue;
+		}
+		scratch.node_costs[node_id] = cost * begin_cluster.owner->get_travel_cost();
+		const NavMapHierarchicalOpenEntry entry = { node_id, scratch.node_costs[node_id], scratch.node_costs[node_id] + hierarchical_nodes[node_id].poly->center.distance_to(p_end_point) * min_travel_cost };
+		open_heap.push_back(entry);
+		heap_sort.push_heap(0, open_heap.size() - 1, 0, entry, open_heap.ptr());
+	}
+
+	// A* over the cluster graph.
+	real_t best_cost = FLT_MAX;
+	int32_t best_node_id = -1;
+	while (!open_heap.is_empty()) {
+		heap_sort.pop_heap(0, open_heap.size(), open_heap.ptr());
+		const NavMapHierarchicalOpenEntry current = open_heap[open_heap.size() - 1];
+		open_heap.resize(open_heap.size() - 1);
+
+		if (current.estimate >= best_cost) {
+			break;
+		}
+		if (current.cost > scratch.node_costs[current.node]) {
+			continue; // Already reached with a lower cost.
+		}
+
+		const uint32_t node_id = current.node;
+		const HierarchicalNode &node = hierarchical_nodes[node_id];
+		const real_t node_cost = current.cost;
+		if (node.cluster == end_cluster_id && scratch.node_goal_costs[node_id] != FLT_MAX) {
+			const real_t cost = node_cost + scratch.node_goal_costs[node_id];
+			if (cost < best_cost) {
+				best_cost = cost;
+				best_node_id = node_id;
+			}
+		}
+
+		const NavBase *owner = hierarchical_clusters[node.cluster].owner;
+		for (const HierarchicalEdge &edge : node.edges) {
+			const HierarchicalNode &next_node = hierarchical_nodes[edge.node];
+			const NavBase *next_owner = hierarchical_clusters[next_node.cluster].owner;
+			if ((p_navigation_layers & next_owner->get_navigation_layers()) == 0) {
+				continue;
+			}
+
+			real_t cost = node_cost + edge.distance * owner->get_travel_cost();
+			if (next_owner != owner) {
+				cost += next_owner->get_enter_cost();
+			}
+			if (cost < scratch.node_costs[edge.node]) {
+				scratch.node_costs[edge.node] = cost;
+				scratch.node_parents[edge.node] = node_id;
+				const NavMapHierarchicalOpenEntry entry = { edge.node, cost, cost + next_node.poly->center.distance_to(p_end_point) * min_travel_cost };
+				open_heap.push_back(entry);
+				heap_sort.push_heap(0, open_heap.size() - 1, 0, entry, open_heap.ptr());
+			}
+		}
+	}
+
+	if (best_node_id == -1) {
+		return false;
+	}
+
+	// Stamp the clusters on the route.
+	const uint32_t cluster_count = hierarchical_clusters.size();
+	if (scratch.corridor.size() != cluster_count || ++scratch.corridor_pass == 0) {
+		scratch.corridor.resize(cluster_count);
+		for (uint32_t &pass : scratch.corridor) {
+			pass = 0;
+		}
+		scratch.corridor_pass = 1;
+	}
+	for (int32_t node_id = best_node_id; node_id != -1; node_id = scratch.node_parents[node_id]) {
+		scratch.corridor[hierarchical_nodes[node_id].cluster] = scratch.corridor_pass;
+	}
+	scratch.corridor[begin_cluster_id] = scratch.corridor_pass;
+	scratch.corridor[end_cluster_id] = scratch.corridor_pass;
+	return true;
+}
+
 Vector3 NavMap::get_closest_point_to_segment(const Vector3 &p_from, const Vector3 &p_to, const bool p_use_collision) const {
 	ERR_FAIL_COND_V_MSG(map_update_id == 0, Vector3(), "NavigationServer map query failed because it was made before first map synchronization.");
 	bool use_collision = p_use_collision;
@@ -1067,6 +1269,10 @@ void NavMap::sync() {
 		map_update_id = map_update_id % 9999999 + 1;
 	}
 
+	if (use_hierarchical_pathfinding && (regenerate_links || !hierarchical_graph_valid)) {
+		_update_hierarchical_graph();
+	}
+
 	// Do we have modified obstacle positions?
 	for (NavObstacle *obstacle : obstacles) {
 		if (obstacle->check_dirty()) {
@@ -1099,6 +1305,132 @@ void NavMap::sync() {
 	pm_edge_merge_count = _new_pm_edge_merge_count;
 	pm_edge_connection_count = _new_pm_edge_connection_count;
 	pm_edge_free_count = _new_pm_edge_free_count;
+	pm_path_query_count = path_query_count.get();
+	path_query_count.sub(pm_path_query_count);
+}
+
+uint32_t NavMap::_get_hierarchical_node(const gd::Polygon *p_polygon) {
+	const uint32_t polygon_index = _get_hierarchical_polygon_index(p_polygon);
+	if (hierarchical_polygon_nodes[polygon_index] != -1) {
+		return hierarchical_polygon_nodes[polygon_index];
+	}
+
+	const uint32_t node_id = hierarchical_nodes.size();
+	HierarchicalNode node;
+	node.poly = p_polygon;
+	node.cluster = hierarchical_polygon_clusters[polygon_index];
+	const HierarchicalCluster &cluster = hierarchical_clusters[node.cluster];
+	if (cluster.region) {
+		node.cluster_index = cluster.region->get_polygon_cluster_index(polygon_index - cluster.polygon_offset);
+	}
+	hierarchical_nodes.push_back(node);
+	hierarchical_clusters[node.cluster].nodes.push_back(node_id);
+	hierarchical_polygon_nodes[polygon_index] = node_id;
+	return node_id;
+}
+
+void NavMap::_update_hierarchical_graph() {
+	hierarchical_clusters.clear();
+	hierarchical_nodes.clear();
+	hierarchical_polygon_clusters.resize(polygons.size() + link_polygons.size());
+	hierarchical_polygon_nodes.resize(polygons.size() + link_polygons.size());
+	for (int32_t &node_id : hierarchical_polygon_nodes) {
+		node_id = -1;
+	}
+
+	// Enabled regions contribute their clusters, in the same order their polygons were copied into the map.
+	uint32_t polygon_offset = 0;
+	for (NavRegion *region : regions) {
+		if (!region->get_enabled()) {
+			continue;
+		}
+		// Only recomputed when the region polygons changed.
+		region->update_abstraction();
+
+		const uint32_t first_cluster = hierarchical_clusters.size();
+		const uint32_t polygon_count = region->get_polygons().size();
+		for (uint32_t i = 0; i < polygon_count; i++) {
+			hierarchical_polygon_clusters[polygon_offset + i] = first_cluster + region->get_polygon_cluster(i);
+		}
+
+		for (uint32_t i = 0; i < region->get_cluster_count(); i++) {
+			HierarchicalCluster cluster;
+			cluster.owner = region;
+			cluster.region = region;
+			cluster.polygon_offset = polygon_offset;
+			hierarchical_clusters.push_back(cluster);
+		}
+		polygon_offset += polygon_count;
+	}
+
+	// Each link polygon is a cluster of its own.
+	for (uint32_t i = 0; i < link_polygons.size(); i++) {
+		hierarchical_polygon_clusters[polygons.size() + i] = hierarchical_clusters.size();
+
+		HierarchicalCluster cluster;
+		cluster.owner = link_polygons[i].owner;
+		cluster.polygon_offset = polygons.size() + i;
+		hierarchical_clusters.push_back(cluster);
+	}
+
+	// Nodes are only the polygons actually connected to another cluster, links being reachable through those.
+	for (const gd::Polygon &poly : polygons) {
+		const uint32_t cluster_id = hierarchical_polygon_clusters[_get_hierarchical_polygon_index(&poly)];
+		for (const gd::Edge &edge : poly.edges) {
+			for (const gd::Edge::Connection &connection : edge.connections) {
+				if (hierarchical_polygon_clusters[_get_hierarchical_polygon_index(connection.polygon)] != cluster_id) {
+					_get_hierarchical_node(&poly);
+					break;
+				}
+			}
+		}
+	}
+
+	// Connections between clusters, the loop also visits the nodes it discovers.
+	for (uint32_t node_id = 0; node_id < hierarchical_nodes.size(); node_id++) {
+		const gd::Polygon *poly = hierarchical_nodes[node_id].poly;
+		const uint32_t cluster_id = hierarchical_nodes[node_id].cluster;
+		for (const gd::Edge &edge : poly->edges) {
+			for (const gd::Edge::Connection &connection : edge.connections) {
+				if (hierarchical_polygon_clusters[_get_hierarchical_polygon_index(connection.polygon)] == cluster_id) {
+					continue;
+				}
+				HierarchicalEdge hierarchical_edge;
+				hierarchical_edge.node = _get_hierarchical_node(connection.polygon);
+				hierarchical_edge.distance = poly->center.distance_to(connection.polygon->center);
+				hierarchical_nodes[node_id].edges.push_back(hierarchical_edge);
+			}
+		}
+	}
+
+	// Connections inside the region clusters. The travel distances are cached by the regions, so only
+	// regions with changed polygons, or polygons that just became nodes, are searched again.
+	for (const HierarchicalCluster &cluster : hierarchical_clusters) {
+		if (!cluster.region) {
+			continue;
+		}
+		for (uint32_t from_node_id : cluster.nodes) {
+			const uint32_t from_polygon = _get_hierarchical_polygon_index(hierarchical_nodes[from_node_id].poly) - cluster.polygon_offset;
+			const real_t *costs = cluster.region->get_cached_cluster_costs(from_polygon);
+			if (!costs) {
+				continue;
+			}
+
+			for (uint32_t to_node_id : cluster.nodes) {
+				if (to_node_id == from_node_id) {
+					continue;
+				}
+				HierarchicalEdge hierarchical_edge;
+				hierarchical_edge.node = to_node_id;
+				hierarchical_edge.distance = costs[hierarchical_nodes[to_node_id].cluster_index];
+				if (hierarchical_edge.distance != FLT_MAX) {
+					hierarchical_nodes[from_node_id].edges.push_back(hierarchical_edge);
+				}
+			}
+		}
+	}
+
+	hierarchical_graph_valid = true;
 }
 
 void NavMap::_update_rvo_obstacles_tree_2d() {
@@ -36,6 +36,7 @@
 
 #include "core/math/math_defs.h"
 #include "core/object/worker_thread_pool.h"
+#include "core/templates/safe_refcount.h"
 
 #include <KdTree2d.h>
 #include <KdTree3d.h>
@@ -66,6 +67,11 @@ class NavMap : public NavRid {
 	bool regenerate_polygons = true;
 	bool regenerate_links = true;
 
+	/// Searches a graph of the region and link clusters first, and then only
+	/// the polygons of the clusters on that route.
+	bool use_hierarchical_pathfinding = false;
+	bool hierarchical_graph_valid = false;
+
 	/// Map regions
 	LocalVector<NavRegion *> regions;
 
@@ -76,6 +82,29 @@ class NavMap : public NavRid {
 	/// Map polygons
 	LocalVector<gd::Polygon> polygons;
 
+	/// Hierarchical pathfinding graph, its nodes are the polygons connecting the clusters.
+	/// Regions are split into clusters of bounded size, each link polygon is a cluster of its own.
+	struct HierarchicalCluster {
+		const NavBase *owner = nullptr;
+		NavRegion *region = nullptr; // Null for links.
+		uint32_t polygon_offset = 0; // Offset of the region (or link) polygons in the map.
+		LocalVector<uint32_t> nodes;
+	};
+	struct HierarchicalEdge {
+		uint32_t node = 0;
+		real_t distance = 0.0;
+	};
+	struct HierarchicalNode {
+		const gd::Polygon *poly = nullptr;
+		uint32_t cluster = 0;
+		uint32_t cluster_index = 0; // Index of the polygon within a region cluster.
+		LocalVector<HierarchicalEdge> edges;
+	};
+	LocalVector<HierarchicalCluster> hierarchical_clusters;
+	LocalVector<HierarchicalNode> hierarchical_nodes;
+	LocalVector<uint32_t> hierarchical_polygon_clusters; // Map polygons first, then link polygons.
+	LocalVector<int32_t> hierarchical_polygon_nodes;
+
 	/// RVO avoidance worlds
 	RVO2D::RVOSimulator2D rvo_simulation_2d;
 	RVO3D::RVOSimulator3D rvo_simulation_3d;
@@ -115,6 +144,8 @@ class NavMap : public NavRid {
 	int pm_edge_merge_count = 0;
 	int pm_edge_connection_count = 0;
 	int pm_edge_free_count = 0;
+	int pm_path_query_count = 0;
+	mutable SafeNumeric<uint32_t> path_query_count; // Since the last sync, as queries can come from any thread.
 
 public:
 	NavMap();
@@ -138,6 +169,11 @@ public:
 		return use_edge_connections;
 	}
 
+	void set_use_hierarchical_pathfinding(bool p_enabled);
+	bool get_use_hierarchical_pathfinding() const {
+		return use_hierarchical_pathfinding;
+	}
+
 	void set_edge_connection_margin(real_t p_edge_connection_margin);
 	real_t get_edge_connection_margin() const {
 		return edge_connection_margin;
@@ -203,6 +239,7 @@ public:
 	int get_pm_edge_merge_count() const { return pm_edge_merge_count; }
 	int get_pm_edge_connection_count() const { return pm_edge_connection_count; }
 	int get_pm_edge_free_count() const { return pm_edge_free_count; }
+	int get_pm_path_query_count() const { return pm_path_query_count; }
 
 private:
 	void compute_single_step(uint32_t index, NavAgent **agent);
@@ -211,6 +248,10 @@ private:
 	void compute_single_avoidance_step_3d(uint32_t index, NavAgent **agent);
 
 	void clip_path(const LocalVector<gd::NavigationPoly> &p_navigation_polys, Vector<Vector3> &path, const gd::NavigationPoly *from_poly, const Vector3 &p_to_point, const gd::NavigationPoly *p_to_poly, Vector<int32_t> *r_path_types, TypedArray<RID> *r_path_rids, Vector<int64_t> *r_path_owners) const;
+	void _update_hierarchical_graph();
+	uint32_t _get_hierarchical_polygon_index(const gd::Polygon *p_polygon) const;
+	uint32_t _get_hierarchical_node(const gd::Polygon *p_polygon);
+	bool _find_hierarchical_corridor(const gd::Polygon *p_begin_poly, const gd::Polygon *p_end_poly, const Vector3 &p_end_point, uint32_t p_navigation_layers) const;
 	void _update_rvo_simulation();
 	void _update_rvo_obstacles_tree_2d();
 	void _update_rvo_agents_tree_2d();
@@ -32,6 +32,8 @@
 
 #include "nav_map.h"
 
+#include "core/templates/sort_array.h"
+
 void NavRegion::set_map(NavMap *p_map) {
 	if (map == p_map) {
 		return;
@@ -114,6 +116,7 @@ void NavRegion::update_polygons() {
 	}
 	polygons.clear();
 	polygons_dirty = false;
+	abstraction_dirty = true;
 
 	if (map == nullptr) {
 		return;
@@ -192,3 +195,172 @@ void NavRegion::update_polygons() {
 		}
 	}
 }
+
+struct NavRegionCostEntry {
+	uint32_t polygon = 0;
+	real_t cost = 0.0;
+};
+
+struct NavRegionCostEntryComparator {
+	_FORCE_INLINE_ bool operator()(const NavRegionCostEntry &p_a, const NavRegionCostEntry &p_b) const {
+		return p_a.cost > p_b.cost;
+	}
+};
+
+static thread_local LocalVector<NavRegionCostEntry> cost_heap;
+
+// Upper bound on the polygons of a cluster, which bounds the cost of searching inside one.
+static const uint32_t NAV_REGION_CLUSTER_MAX_POLYGONS = 64;
+
+void NavRegion::update_abstraction() {
+	if (!abstraction_dirty) {
+		return;
+	}
+	abstraction_dirty = false;
+
+	neighbor_offsets.clear();
+	neighbors.clear();
+	polygon_clusters.clear();
+	polygon_cluster_indices.clear();
+	cluster_offsets.clear();
+	cluster_polygons.clear();
+	polygon_cost_offsets.clear();
+	cluster_costs.clear();
+
+	const uint32_t polygon_count = polygons.size();
+
+	// Pair up the polygons sharing an edge, the same way the map merges them.
+	HashMap<gd::EdgeKey, int64_t, gd::EdgeKey> edge_polygons;
+	LocalVector<uint32_t> pairs;
+	for (uint32_t i = 0; i < polygon_count; i++) {
+		const gd::Polygon &poly = polygons[i];
+		for (uint32_t p = 0; p < poly.points.size(); p++) {
+			gd::EdgeKey ek(poly.points[p].key, poly.points[(p + 1) % poly.points.size()].key);
+			HashMap<gd::EdgeKey, int64_t, gd::EdgeKey>::Iterator E = edge_polygons.find(ek);
+			if (!E) {
+				edge_polygons.insert(ek, i);
+			} else if (E->value >= 0 && E->value != int64_t(i)) {
+				pairs.push_back(E->value);
+				pairs.push_back(i);
+				E->value = -1;
+			}
+		}
+	}
+
+	neighbor_offsets.resize(polygon_count + 1);
+	for (uint32_t &offset : neighbor_offsets) {
+		offset = 0;
+	}
+	for (uint32_t polygon : pairs) {
+		neighbor_offsets[polygon + 1]++;
+	}
+	for (uint32_t i = 0; i < polygon_count; i++) {
+		neighbor_offsets[i + 1] += neighbor_offsets[i];
+	}
+	neighbors.resize(pairs.size());
+	LocalVector<uint32_t> fill_offsets = neighbor_offsets;
+	for (uint32_t i = 0; i < pairs.size(); i += 2) {
+		neighbors[fill_offsets[pairs[i]]++] = pairs[i + 1];
+		neighbors[fill_offsets[pairs[i + 1]]++] = pairs[i];
+	}
+
+	// Grow clusters breadth first from the first unassigned polygon, so each one is connected and compact.
+	polygon_clusters.resize(polygon_count);
+	polygon_cluster_indices.resize(polygon_count);
+	for (uint32_t &cluster : polygon_clusters) {
+		cluster = UINT32_MAX;
+	}
+	cluster_polygons.reserve(polygon_count);
+	for (uint32_t seed = 0; seed < polygon_count; seed++) {
+		if (polygon_clusters[seed] != UINT32_MAX) {
+			continue;
+		}
+		const uint32_t cluster = cluster_offsets.size();
+		const uint32_t cluster_begin = cluster_polygons.size();
+		cluster_offsets.push_back(cluster_begin);
+
+		polygon_clusters[seed] = cluster;
+		cluster_polygons.push_back(seed);
+		for (uint32_t i = cluster_begin; i < cluster_polygons.size(); i++) {
+			const uint32_t polygon = cluster_polygons[i];
+			polygon_cluster_indices[polygon] = i - cluster_begin;
+			for (uint32_t n = neighbor_offsets[polygon]; n < neighbor_offsets[polygon + 1]; n++) {
+				const uint32_t neighbor = neighbors[n];
+				if (polygon_clusters[neighbor] == UINT32_MAX && cluster_polygons.size() - cluster_begin < NAV_REGION_CLUSTER_MAX_POLYGONS) {
+					polygon_clusters[neighbor] = cluster;
+					cluster_polygons.push_back(neighbor);
+				}
+			}
+		}
+	}
+	cluster_offsets.push_back(cluster_polygons.size());
+
+	polygon_cost_offsets.resize(polygon_count);
+	for (uint32_t &offset : polygon_cost_offsets) {
+		offset = UINT32_MAX;
+	}
+}
+
+void NavRegion::get_cluster_costs(uint32_t p_from, LocalVector<real_t> &r_costs) const {
+	ERR_FAIL_COND(abstraction_dirty);
+	ERR_FAIL_UNSIGNED_INDEX(p_from, polygons.size());
+
+	const uint32_t cluster = polygon_clusters[p_from];
+	r_costs.resize(cluster_offsets[cluster + 1] - cluster_offsets[cluster]);
+	_search_cluster_costs(p_from, r_costs.ptr());
+}
+
+const real_t *NavRegion::get_cached_cluster_costs(uint32_t p_from) {
+	ERR_FAIL_COND_V(abstraction_dirty, nullptr);
+	ERR_FAIL_UNSIGNED_INDEX_V(p_from, polygons.size(), nullptr);
+
+	if (polygon_cost_offsets[p_from] == UINT32_MAX) {
+		const uint32_t cluster = polygon_clusters[p_from];
+		polygon_cost_offsets[p_from] = cluster_costs.size();
+		cluster_costs.resize(cluster_costs.size() + cluster_offsets[cluster + 1] - cluster_offsets[cluster]);
+		_search_cluster_costs(p_from, &cluster_costs[polygon_cost_offsets[p_from]]);
+	}
+	return &cluster_costs[polygon_cost_offsets[p_from]];
+}
+
+void NavRegion::_search_cluster_costs(uint32_t p_from, real_t *r_costs) const {
+	const uint32_t cluster = polygon_clusters[p_from];
+	const uint32_t cluster_size = cluster_offsets[cluster + 1] - cluster_offsets[cluster];
+	for (uint32_t i = 0; i < cluster_size; i++) {
+		r_costs[i] = FLT_MAX;
+	}
+
+	// Dijkstra over the polygon centers, without leaving the cluster.
+	SortArray<NavRegionCostEntry, NavRegionCostEntryComparator> heap_sort;
+	LocalVector<NavRegionCostEntry> &heap = cost_heap;
+	heap.clear();
+
+	r_costs[polygon_cluster_indices[p_from]] = 0.0;
+	heap.push_back({ p_from, 0.0 });
+
+	while (!heap.is_empty()) {
+		heap_sort.pop_heap(0, heap.size(), heap.ptr());
+		const NavRegionCostEntry current = heap[heap.size() - 1];
+		heap.resize(heap.size() - 1);
+
+		if (current.cost > r_costs[polygon_cluster_indices[current.polygon]]) {
+			continue; // Already reached with a lower cost.
+		}
+
+		const Vector3 &center = polygons[current.polygon].center;
+		for (uint32_t n = neighbor_offsets[current.polygon]; n < neighbor_offsets[current.polygon + 1]; n++) {
+			const uint32_t neighbor = neighbors[n];
+			if (polygon_clusters[neighbor] != cluster) {
+				continue;
+			}
+			const real_t cost = current.cost + center.distance_to(polygons[neighbor].center);
+			real_t &neighbor_cost = r_costs[polygon_cluster_indices[neighbor]];
+			if (cost < neighbor_cost) {
+				neighbor_cost = cost;
+				const NavRegionCostEntry entry = { neighbor, cost };
+				heap.push_back(entry);
+				heap_sort.push_heap(0, heap.size() - 1, 0, entry, heap.ptr());
+			}
+		}
+	}
+}
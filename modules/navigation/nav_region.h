@@ -50,6 +50,19 @@ class NavRegion : public NavBase {
 	/// Cache
 	LocalVector<gd::Polygon> polygons;
 
+	/// Hierarchical pathfinding cache, only rebuilt when the polygons change.
+	/// The polygons are split into connected clusters of bounded size.
+	bool abstraction_dirty = true;
+	LocalVector<uint32_t> neighbor_offsets;
+	LocalVector<uint32_t> neighbors;
+	LocalVector<uint32_t> polygon_clusters;
+	LocalVector<uint32_t> polygon_cluster_indices; // Index of each polygon within its cluster.
+	LocalVector<uint32_t> cluster_offsets;
+	LocalVector<uint32_t> cluster_polygons;
+	/// Travel distances inside the clusters, searched for the polygons the map asks for.
+	LocalVector<uint32_t> polygon_cost_offsets; // UINT32_MAX until searched.
+	LocalVector<real_t> cluster_costs;
+
 public:
 	NavRegion() {
 		type = NavigationUtilities::PathSegmentType::PATH_SEGMENT_TYPE_REGION;
@@ -95,8 +108,25 @@ public:
 
 	bool sync();
 
+	void update_abstraction();
+	uint32_t get_cluster_count() const {
+		return cluster_offsets.is_empty() ? 0 : cluster_offsets.size() - 1;
+	}
+	uint32_t get_polygon_cluster(uint32_t p_polygon) const {
+		return polygon_clusters[p_polygon];
+	}
+	uint32_t get_polygon_cluster_index(uint32_t p_polygon) const {
+		return polygon_cluster_indices[p_polygon];
+	}
+	// Travel distances from a polygon to the polygons of its cluster, indexed like get_polygon_cluster_index().
+	void get_cluster_costs(uint32_t p_from, LocalVector<real_t> &r_costs) const;
+	// Same, but searched on the first call and then kept until the polygons change.
+	// Not thread-safe, and the result is only valid until the next call.
+	const real_t *get_cached_cluster_costs(uint32_t p_from);
+
 private:
 	void update_polygons();
+	void _search_cluster_costs(uint32_t p_from, real_t *r_costs) const;
 };
 
 #endif // NAV_REGION_H
@@ -30,6 +30,7 @@
 
 #include "audio_stream_ogg_vorbis.h"
 
+#include "core/config/project_settings.h"
 #include "core/io/file_access.h"
 #include "core/variant/typed_array.h"
 
@@ -37,6 +38,13 @@
 #include <ogg/ogg.h>
 
 int AudioStreamPlaybackOggVorbis::_mix_internal(AudioFrame *p_buffer, int p_frames) {
+	if (decode_ahead) {
+		return _mix_decoded_ahead(p_buffer, p_frames);
+	}
+	return _decode_frames(p_buffer, p_frames);
+}
+
+int AudioStreamPlaybackOggVorbis::_decode_frames(AudioFrame *p_buffer, int p_frames) {
 	ERR_FAIL_COND_V(!ready, 0);
 
 	if (!active) {
@@ -115,7 +123,7 @@ int AudioStreamPlaybackOggVorbis::_mix_internal(AudioFrame *p_buffer, int p_fram
 					loop_fade_remaining = 0;
 				}
 
-				seek(vorbis_stream->loop_offset);
+				_seek(vorbis_stream->loop_offset);
 				loops++;
 				// We still have buffer to fill, start from this element in the next iteration.
 				continue;
@@ -128,7 +136,7 @@ int AudioStreamPlaybackOggVorbis::_mix_internal(AudioFrame *p_buffer, int p_fram
 			if (vorbis_stream->loop && is_not_empty) {
 				//loop
 
-				seek(vorbis_stream->loop_offset);
+				_seek(vorbis_stream->loop_offset);
 				loops++;
 				// We still have buffer to fill, start from this element in the next iteration.
 
@@ -145,6 +153,18 @@ int AudioStreamPlaybackOggVorbis::_mix_internal(AudioFrame *p_buffer, int p_fram
 
 int AudioStreamPlaybackOggVorbis::_mix_frames_vorbis(AudioFrame *p_buffer, int p_frames) {
 	ERR_FAIL_COND_V(!ready, p_frames);
+	if (!pcm.is_empty()) {
+		int frames = MIN(p_frames, pcm.size() - pcm_position);
+		const AudioFrame *src = pcm.ptr() + pcm_position;
+		for (int i = 0; i < frames; i++) {
+			p_buffer[i] = src[i];
+		}
+		pcm_position += frames;
+		have_samples_left = pcm_position < pcm.size();
+		have_packets_left = false;
+		return frames;
+	}
+
 	if (!have_samples_left) {
 		ogg_packet *packet = nullptr;
 		int err;
@@ -164,9 +184,9 @@ int AudioStreamPlaybackOggVorbis::_mix_frames_vorbis(AudioFrame *p_buffer, int p
 		have_packets_left = !packet->e_o_s;
 	}
 
-	float **pcm; // Accessed with pcm[channel_idx][sample_idx].
+	float **channels; // Accessed with channels[channel_idx][sample_idx].
 
-	int frames = vorbis_synthesis_pcmout(&dsp_state, &pcm);
+	int frames = vorbis_synthesis_pcmout(&dsp_state, &channels);
 	if (frames > p_frames) {
 		frames = p_frames;
 		have_samples_left = true;
@@ -176,19 +196,97 @@ int AudioStreamPlaybackOggVorbis::_mix_frames_vorbis(AudioFrame *p_buffer, int p
 
 	if (info.channels > 1) {
 		for (int frame = 0; frame < frames; frame++) {
-			p_buffer[frame].l = pcm[0][frame];
-			p_buffer[frame].r = pcm[1][frame];
+			p_buffer[frame].l = channels[0][frame];
+			p_buffer[frame].r = channels[1][frame];
 		}
 	} else {
 		for (int frame = 0; frame < frames; frame++) {
-			p_buffer[frame].l = pcm[0][frame];
-			p_buffer[frame].r = pcm[0][frame];
+			p_buffer[frame].l = channels[0][frame];
+			p_buffer[frame].r = channels[0][frame];
 		}
 	}
 	vorbis_synthesis_read(&dsp_state, frames);
 	return frames;
 }
 
+void AudioStreamPlaybackOggVorbis::_decode_ahead_task(void *p_userdata) {
+	AudioStreamPlaybackOggVorbis *playback = (AudioStreamPlaybackOggVorbis *)p_userdata;
+	MutexLock lock(playback->decode_mutex);
+	playback->_decode_ahead();
+}
+
+// Decodes until the ring buffer is full, the stream ends or p_max_chunks were decoded. Call with decode_mutex locked.
+void AudioStreamPlaybackOggVorbis::_decode_ahead(uint32_t p_max_chunks) {
+	for (uint32_t chunk = 0; chunk < p_max_chunks && active && !decode_ahead_exit.is_set(); chunk++) {
+		uint64_t write = decode_ahead_write.get();
+		// Frames before the skip position are stale, they can be overwritten even if not read yet.
+		if (DECODE_AHEAD_SIZE - (write - MAX(decode_ahead_read.get(), decode_ahead_skip.get())) < DECODE_AHEAD_CHUNK) {
+			return;
+		}
+
+		uint32_t offset = write & (DECODE_AHEAD_SIZE - 1);
+		int to_decode = MIN((uint32_t)DECODE_AHEAD_CHUNK, DECODE_AHEAD_SIZE - offset);
+		int decoded = _decode_frames(&decode_ahead_buffer[offset], to_decode);
+		decode_ahead_write.set(write + decoded);
+
+		if (decoded < to_decode) {
+			break;
+		}
+	}
+
+	if (!active) {
+		decode_ahead_ended.set();
+	}
+}
+
+void AudioStreamPlaybackOggVorbis::_request_decode_ahead() {
+	if (decode_ahead_write.get() - MAX(decode_ahead_read.get(), decode_ahead_skip.get()) > DECODE_AHEAD_SIZE / 2 || decode_ahead_ended.is_set()) {
+		return;
+	}
+
+	WorkerThreadPool *pool = WorkerThreadPool::get_singleton();
+	if (decode_ahead_task != WorkerThreadPool::INVALID_TASK_ID) {
+		if (!pool->is_task_completed(decode_ahead_task)) {
+			return;
+		}
+		// Already done, this only releases the task.
+		pool->wait_for_task_completion(decode_ahead_task);
+	}
+
+	decode_ahead_task = pool->add_native_task(&AudioStreamPlaybackOggVorbis::_decode_ahead_task, this, true, SNAME("OggVorbisDecodeAhead"));
+}
+
+int AudioStreamPlaybackOggVorbis::_mix_decoded_ahead(AudioFrame *p_buffer, int p_frames) {
+	if (!decode_ahead_playing) {
+		return 0;
+	}
+
+	// Check for the end first, the decoder only sets it after writing its last frames.
+	bool ended = decode_ahead_ended.is_set();
+	uint64_t read = MAX(decode_ahead_read.get(), decode_ahead_skip.get());
+	int frames = MIN(decode_ahead_write.get() - read, (uint64_t)p_frames);
+
+	for (int i = 0; i < frames; i++) {
+		p_buffer[i] = decode_ahead_buffer[(read + i) & (DECODE_AHEAD_SIZE - 1)];
+	}
+	decode_ahead_read.set(read + frames);
+
+	if (frames < p_frames) {
+		for (int i = frames; i < p_frames; i++) {
+			p_buffer[i] = AudioFrame(0, 0);
+		}
+		// Check again, a seek restarts the decoder by clearing the flag before moving the skip position.
+		if (ended && decode_ahead_ended.is_set()) {
+			decode_ahead_playing = false;
+			return frames;
+		}
+		// Otherwise the decoder fell behind, so the rest stays silent.
+	}
+
+	_request_decode_ahead();
+	return p_frames;
+}
+
 float AudioStreamPlaybackOggVorbis::get_stream_sampling_rate() {
 	return vorbis_data->get_sampling_rate();
 }
@@ -230,19 +328,38 @@ bool AudioStreamPlaybackOggVorbis::_alloc_vorbis() {
 
 void AudioStreamPlaybackOggVorbis::start(double p_from_pos) {
 	ERR_FAIL_COND(!ready);
-	loop_fade_remaining = FADE_SIZE;
-	active = true;
-	seek(p_from_pos);
-	loops = 0;
+
+	if (decode_ahead) {
+		MutexLock lock(decode_mutex);
+		loop_fade_remaining = FADE_SIZE;
+		active = true;
+		_seek(p_from_pos);
+		loops = 0;
+
+		// The read position belongs to the audio thread, skipping the stale frames is published through the skip position.
+		decode_ahead_ended.clear();
+		decode_ahead_skip.set(decode_ahead_write.get());
+		decode_ahead_playing = true;
+		// Decode one chunk right away, so playback doesn't start with silence.
+		// This can run on the audio thread, so the next mix queues the rest on the pool.
+		_decode_ahead(1);
+	} else {
+		loop_fade_remaining = FADE_SIZE;
+		active = true;
+		_seek(p_from_pos);
+		loops = 0;
+	}
+
 	begin_resample();
 }
 
 void AudioStreamPlaybackOggVorbis::stop() {
 	active = false;
+	decode_ahead_playing = false;
 }
 
 bool AudioStreamPlaybackOggVorbis::is_playing() const {
-	return active;
+	return decode_ahead ? decode_ahead_playing : active;
 }
 
 int AudioStreamPlaybackOggVorbis::get_loop_count() const {
@@ -250,7 +367,12 @@ int AudioStreamPlaybackOggVorbis::get_loop_count() const {
 }
 
 double AudioStreamPlaybackOggVorbis::get_playback_position() const {
-	return double(frames_mixed) / (double)vorbis_data->get_sampling_rate();
+	double position = frames_mixed;
+	if (decode_ahead) {
+		// The decoder is ahead by what's still buffered.
+		position -= decode_ahead_write.get() - MAX(decode_ahead_read.get(), decode_ahead_skip.get());
+	}
+	return MAX(position, 0.0) / (double)vorbis_data->get_sampling_rate();
 }
 
 void AudioStreamPlaybackOggVorbis::tag_used_streams() {
@@ -258,6 +380,25 @@ void AudioStreamPlaybackOggVorbis::tag_used_streams() {
 }
 
 void AudioStreamPlaybackOggVorbis::seek(double p_time) {
+	if (decode_ahead) {
+		MutexLock lock(decode_mutex);
+		if (!decode_ahead_playing) {
+			return;
+		}
+		// The decoder may have reached the end of the stream while its last frames are still buffered.
+		// Playback goes on, so restart it from the new position.
+		active = true;
+		_seek(p_time);
+		decode_ahead_ended.clear();
+		decode_ahead_skip.set(decode_ahead_write.get());
+		_decode_ahead(1);
+		return;
+	}
+
+	_seek(p_time);
+}
+
+void AudioStreamPlaybackOggVorbis::_seek(double p_time) {
 	ERR_FAIL_COND(!ready);
 	ERR_FAIL_COND(vorbis_stream.is_null());
 	if (!active) {
@@ -272,6 +413,13 @@ void AudioStreamPlaybackOggVorbis::seek(double p_time) {
 
 	const int64_t desired_sample = p_time * get_stream_sampling_rate();
 
+	if (!pcm.is_empty()) {
+		pcm_position = MIN(desired_sample, (int64_t)pcm.size());
+		have_samples_left = pcm_position < pcm.size();
+		have_packets_left = false;
+		return;
+	}
+
 	if (!vorbis_data_playback->seek_page(desired_sample)) {
 		WARN_PRINT("seek failed");
 		return;
@@ -357,6 +505,10 @@ void AudioStreamPlaybackOggVorbis::seek(double p_time) {
 }
 
 AudioStreamPlaybackOggVorbis::~AudioStreamPlaybackOggVorbis() {
+	if (decode_ahead_task != WorkerThreadPool::INVALID_TASK_ID) {
+		decode_ahead_exit.set();
+		WorkerThreadPool::get_singleton()->wait_for_task_completion(decode_ahead_task);
+	}
 	if (block_is_allocated) {
 		vorbis_block_clear(&block);
 	}
@@ -382,13 +534,166 @@ Ref<AudioStreamPlayback> AudioStreamOggVorbis::instantiate_playback() {
 	ovs->frames_mixed = 0;
 	ovs->active = false;
 	ovs->loops = 0;
+
+	ovs->pcm = _get_cached_pcm();
+	if (!ovs->pcm.is_empty()) {
+		ovs->ready = true;
+		return ovs;
+	}
+
 	if (ovs->_alloc_vorbis()) {
+		if (decode_ahead_enabled && WorkerThreadPool::get_singleton()->get_thread_count() > 0) {
+			ovs->decode_ahead = true;
+			ovs->decode_ahead_buffer.resize(AudioStreamPlaybackOggVorbis::DECODE_AHEAD_SIZE);
+		}
 		return ovs;
 	}
 	// Failed to allocate data structures.
 	return nullptr;
 }
 
+void OggVorbisPCMCache::set_max_size(uint64_t p_max_size) {
+	MutexLock lock(mutex);
+	max_size = p_max_size;
+	while (size > max_size) {
+		erase(lru.back()->get());
+	}
+}
+
+uint64_t OggVorbisPCMCache::get_max_size() const {
+	return max_size;
+}
+
+uint64_t OggVorbisPCMCache::get_size() const {
+	MutexLock lock(mutex);
+	return size;
+}
+
+bool OggVorbisPCMCache::has(ObjectID p_stream) const {
+	MutexLock lock(mutex);
+	return entries.has(p_stream);
+}
+
+// Marks the stream as the most recently used one.
+bool OggVorbisPCMCache::get(ObjectID p_stream, Vector<AudioFrame> &r_frames) {
+	MutexLock lock(mutex);
+	Entry *entry = entries.getptr(p_stream);
+	if (!entry) {
+		return false;
+	}
+	lru.move_to_front(entry->lru);
+	r_frames = entry->frames;
+	return true;
+}
+
+// Evicts the least recently used streams to make room. Returns the cached frames, which are the
+// ones of another thread if it inserted the same stream first.
+Vector<AudioFrame> OggVorbisPCMCache::insert(ObjectID p_stream, const Vector<AudioFrame> &p_frames) {
+	uint64_t frames_size = sizeof(AudioFrame) * p_frames.size();
+
+	MutexLock lock(mutex);
+	Entry *entry = entries.getptr(p_stream);
+	if (entry) {
+		lru.move_to_front(entry->lru);
+		return entry->frames;
+	}
+
+	if (p_frames.is_empty() || frames_size > max_size) {
+		return p_frames;
+	}
+
+	while (size + frames_size > max_size) {
+		erase(lru.back()->get());
+	}
+
+	Entry new_entry;
+	new_entry.frames = p_frames;
+	new_entry.lru = lru.push_front(p_stream);
+	entries.insert(p_stream, new_entry);
+	size += frames_size;
+
+	return p_frames;
+}
+
+void OggVorbisPCMCache::erase(ObjectID p_stream) {
+	MutexLock lock(mutex);
+	Entry *entry = entries.getptr(p_stream);
+	if (entry) {
+		size -= sizeof(AudioFrame) * entry->frames.size();
+		lru.erase(entry->lru);
+		entries.erase(p_stream);
+	}
+}
+
+void OggVorbisPCMCache::clear() {
+	MutexLock lock(mutex);
+	entries.clear();
+	lru.clear();
+	size = 0;
+}
+
+OggVorbisPCMCache AudioStreamOggVorbis::pcm_cache;
+double AudioStreamOggVorbis::pcm_cache_max_length = 0.0;
+bool AudioStreamOggVorbis::decode_ahead_enabled = false;
+
+void AudioStreamOggVorbis::initialize_pcm_cache() {
+	pcm_cache.set_max_size(uint64_t(int(GLOBAL_DEF(PropertyInfo(Variant::INT, "audio/ogg_vorbis/pcm_cache_size_mb", PROPERTY_HINT_RANGE, "0,1024,1,or_greater,suffix:MiB"), 0))) * 1024 * 1024);
+	pcm_cache_max_length = GLOBAL_DEF(PropertyInfo(Variant::FLOAT, "audio/ogg_vorbis/pcm_cache_max_stream_length", PROPERTY_HINT_RANGE, "0,30,0.1,or_greater,suffix:s"), 5.0);
+	decode_ahead_enabled = GLOBAL_DEF("audio/ogg_vorbis/decode_ahead", false);
+}
+
+void AudioStreamOggVorbis::finish_pcm_cache() {
+	pcm_cache.clear();
+}
+
+// Returns the decoded stream if it's short enough to be cached, decoding it on the first use.
+Vector<AudioFrame> AudioStreamOggVorbis::_get_cached_pcm() {
+	double stream_length = get_length();
+	if (pcm_cache.get_max_size() == 0 || stream_length <= 0.0 || stream_length > pcm_cache_max_length) {
+		return Vector<AudioFrame>();
+	}
+
+	Vector<AudioFrame> pcm;
+	if (pcm_cache.get(get_instance_id(), pcm)) {
+		return pcm;
+	}
+
+	Ref<AudioStreamPlaybackOggVorbis> decoder;
+	decoder.instantiate();
+	decoder->vorbis_stream = Ref<AudioStreamOggVorbis>(this);
+	decoder->vorbis_data = packet_sequence;
+	if (!decoder->_alloc_vorbis()) {
+		return Vector<AudioFrame>();
+	}
+
+	decoder->active = true;
+	decoder->_seek(0);
+
+	LocalVector<AudioFrame> frames;
+	AudioFrame buffer[1024];
+	while (decoder->have_samples_left || decoder->have_packets_left) {
+		int decoded = decoder->_mix_frames_vorbis(buffer, 1024);
+		if (decoded < 0) {
+			break;
+		}
+		for (int i = 0; i < decoded; i++) {
+			frames.push_back(buffer[i]);
+		}
+	}
+
+	pcm.resize(frames.size());
+	AudioFrame *pcm_ptrw = pcm.ptrw();
+	for (uint32_t i = 0; i < frames.size(); i++) {
+		pcm_ptrw[i] = frames[i];
+	}
+
+	return pcm_cache.insert(get_instance_id(), pcm);
+}
+
+void AudioStreamOggVorbis::_erase_cached_pcm() {
+	pcm_cache.erase(get_instance_id());
+}
+
 String AudioStreamOggVorbis::get_stream_name() const {
 	return ""; //return stream_name;
 }
@@ -428,6 +733,7 @@ void AudioStreamOggVorbis::maybe_update_info() {
 }
 
 void AudioStreamOggVorbis::set_packet_sequence(Ref<OggPacketSequence> p_packet_sequence) {
+	_erase_cached_pcm();
 	packet_sequence = p_packet_sequence;
 	if (packet_sequence.is_valid()) {
 		maybe_update_info();
@@ -525,7 +831,9 @@ void AudioStreamOggVorbis::_bind_methods() {
 
 AudioStreamOggVorbis::AudioStreamOggVorbis() {}
 
-AudioStreamOggVorbis::~AudioStreamOggVorbis() {}
+AudioStreamOggVorbis::~AudioStreamOggVorbis() {
+	_erase_cached_pcm();
+}
 
 Ref<AudioStreamOggVorbis> AudioStreamOggVorbis::load_from_buffer(const Vector<uint8_t> &file_data) {
 	return ResourceImporterOggVorbis::load_from_buffer(file_data);
@@ -31,6 +31,10 @@
 #ifndef AUDIO_STREAM_OGG_VORBIS_H
 #define AUDIO_STREAM_OGG_VORBIS_H
 
+#include "core/object/worker_thread_pool.h"
+#include "core/os/mutex.h"
+#include "core/templates/local_vector.h"
+#include "core/templates/safe_refcount.h"
 #include "core/variant/variant.h"
 #include "modules/ogg/ogg_packet_sequence.h"
 #include "servers/audio/audio_stream.h"
@@ -39,6 +43,32 @@
 
 class AudioStreamOggVorbis;
 
+// Short streams can be decoded once and shared by all their playbacks. The least
+// recently used streams are evicted once the cache holds more than its maximum size.
+class OggVorbisPCMCache {
+	struct Entry {
+		Vector<AudioFrame> frames;
+		List<ObjectID>::Element *lru = nullptr;
+	};
+
+	mutable Mutex mutex;
+	HashMap<ObjectID, Entry> entries;
+	List<ObjectID> lru; // Most recently used first.
+	uint64_t size = 0;
+	uint64_t max_size = 0;
+
+public:
+	void set_max_size(uint64_t p_max_size);
+	uint64_t get_max_size() const;
+	uint64_t get_size() const;
+
+	bool has(ObjectID p_stream) const;
+	bool get(ObjectID p_stream, Vector<AudioFrame> &r_frames);
+	Vector<AudioFrame> insert(ObjectID p_stream, const Vector<AudioFrame> &p_frames);
+	void erase(ObjectID p_stream);
+	void clear();
+};
+
 class AudioStreamPlaybackOggVorbis : public AudioStreamPlaybackResampled {
 	GDCLASS(AudioStreamPlaybackOggVorbis, AudioStreamPlaybackResampled);
 
@@ -73,8 +103,37 @@ class AudioStreamPlaybackOggVorbis : public AudioStreamPlaybackResampled {
 	Ref<OggPacketSequencePlayback> vorbis_data_playback;
 	Ref<AudioStreamOggVorbis> vorbis_stream;
 
+	// Decoded frames shared through the stream's PCM cache. When set, nothing is decoded.
+	Vector<AudioFrame> pcm;
+	int pcm_position = 0;
+
+	// Decode-ahead moves decoding to the WorkerThreadPool. The decoder fills a ring buffer
+	// that mixing only reads from, so the decoder state belongs to decode_mutex.
+	enum {
+		DECODE_AHEAD_SIZE = 16384, // Power of 2.
+		DECODE_AHEAD_CHUNK = 1024,
+	};
+
+	bool decode_ahead = false;
+	bool decode_ahead_playing = false;
+	LocalVector<AudioFrame> decode_ahead_buffer;
+	SafeNumeric<uint64_t> decode_ahead_read;
+	SafeNumeric<uint64_t> decode_ahead_write;
+	SafeNumeric<uint64_t> decode_ahead_skip; // Frames before this are stale after seeking.
+	SafeFlag decode_ahead_ended;
+	SafeFlag decode_ahead_exit;
+	WorkerThreadPool::TaskID decode_ahead_task = WorkerThreadPool::INVALID_TASK_ID;
+	Mutex decode_mutex;
+
+	static void _decode_ahead_task(void *p_userdata);
+	void _decode_ahead(uint32_t p_max_chunks = UINT32_MAX);
+	void _request_decode_ahead();
+	int _mix_decoded_ahead(AudioFrame *p_buffer, int p_frames);
+
 	int _mix_frames(AudioFrame *p_buffer, int p_frames);
+	int _decode_frames(AudioFrame *p_buffer, int p_frames);
 	int _mix_frames_vorbis(AudioFrame *p_buffer, int p_frames);
+	void _seek(double p_time);
 
 	// Allocates vorbis data structures. Returns true upon success, false on failure.
 	bool _alloc_vorbis();
@@ -117,6 +176,13 @@ class AudioStreamOggVorbis : public AudioStream {
 
 	Ref<OggPacketSequence> packet_sequence;
 
+	static OggVorbisPCMCache pcm_cache;
+	static double pcm_cache_max_length;
+	static bool decode_ahead_enabled;
+
+	Vector<AudioFrame> _get_cached_pcm();
+	void _erase_cached_pcm();
+
 	double bpm = 0;
 	int beat_count = 0;
 	int bar_beats = 4;
@@ -125,6 +191,10 @@ protected:
 	static void _bind_methods();
 
 public:
+	static void initialize_pcm_cache();
+	static void finish_pcm_cache();
+	static OggVorbisPCMCache &get_pcm_cache() { return pcm_cache; }
+
 	static Ref<AudioStreamOggVorbis> load_from_file(const String &p_path);
 	static Ref<AudioStreamOggVorbis> load_from_buffer(const Vector<uint8_t> &file_data);
 	void set_loop(bool p_enable);
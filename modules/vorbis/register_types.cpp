@@ -54,10 +54,14 @@ void initialize_vorbis_module(ModuleInitializationLevel p_level) {
 
 	GDREGISTER_CLASS(AudioStreamOggVorbis);
 	GDREGISTER_CLASS(AudioStreamPlaybackOggVorbis);
+
+	AudioStreamOggVorbis::initialize_pcm_cache();
 }
 
 void uninitialize_vorbis_module(ModuleInitializationLevel p_level) {
 	if (p_level != MODULE_INITIALIZATION_LEVEL_SCENE) {
 		return;
 	}
+
+	AudioStreamOggVorbis::finish_pcm_cache();
 }
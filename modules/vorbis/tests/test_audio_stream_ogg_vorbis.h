@@ -0,0 +1,145 @@
+/**************************************************************************/
+/*  test_audio_stream_ogg_vorbis.h                                        */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#ifndef TEST_AUDIO_STREAM_OGG_VORBIS_H
+#define TEST_AUDIO_STREAM_OGG_VORBIS_H
+
+#include "../audio_stream_ogg_vorbis.h"
+
+#include "tests/test_macros.h"
+
+namespace TestAudioStreamOggVorbis {
+
+Vector<AudioFrame> make_frames(int p_count) {
+	Vector<AudioFrame> frames;
+	frames.resize(p_count);
+	for (int i = 0; i < p_count; i++) {
+		frames.write[i] = AudioFrame(i, -i);
+	}
+	return frames;
+}
+
+TEST_CASE("[OggVorbisPCMCache] Size accounting") {
+	OggVorbisPCMCache cache;
+	cache.set_max_size(sizeof(AudioFrame) * 1000);
+
+	cache.insert(ObjectID(uint64_t(1)), make_frames(100));
+	cache.insert(ObjectID(uint64_t(2)), make_frames(200));
+	CHECK(cache.get_size() == sizeof(AudioFrame) * 300);
+
+	// Inserting a stream again keeps the first frames.
+	Vector<AudioFrame> frames = cache.insert(ObjectID(uint64_t(1)), make_frames(50));
+	CHECK(frames.size() == 100);
+	CHECK(cache.get_size() == sizeof(AudioFrame) * 300);
+
+	CHECK(cache.get(ObjectID(uint64_t(2)), frames));
+	CHECK(frames.size() == 200);
+	CHECK(frames[199].l == 199);
+	CHECK(frames[199].r == -199);
+
+	cache.erase(ObjectID(uint64_t(1)));
+	CHECK_FALSE(cache.has(ObjectID(uint64_t(1))));
+	CHECK(cache.get_size() == sizeof(AudioFrame) * 200);
+
+	// Erasing a stream that isn't cached changes nothing.
+	cache.erase(ObjectID(uint64_t(1)));
+	CHECK(cache.get_size() == sizeof(AudioFrame) * 200);
+
+	// Streams larger than the whole cache are returned but not cached.
+	frames = cache.insert(ObjectID(uint64_t(3)), make_frames(1001));
+	CHECK(frames.size() == 1001);
+	CHECK_FALSE(cache.has(ObjectID(uint64_t(3))));
+	CHECK(cache.get_size() == sizeof(AudioFrame) * 200);
+
+	cache.clear();
+	CHECK(cache.get_size() == 0);
+	CHECK_FALSE(cache.has(ObjectID(uint64_t(2))));
+}
+
+TEST_CASE("[OggVorbisPCMCache] Least recently used streams are evicted first") {
+	OggVorbisPCMCache cache;
+	cache.set_max_size(sizeof(AudioFrame) * 300);
+
+	cache.insert(ObjectID(uint64_t(1)), make_frames(100));
+	cache.insert(ObjectID(uint64_t(2)), make_frames(100));
+	cache.insert(ObjectID(uint64_t(3)), make_frames(100));
+
+	// Using the oldest stream makes the second one the least recently used.
+	Vector<AudioFrame> frames;
+	CHECK(cache.get(ObjectID(uint64_t(1)), frames));
+
+	cache.insert(ObjectID(uint64_t(4)), make_frames(100));
+	CHECK(cache.has(ObjectID(uint64_t(1))));
+	CHECK_FALSE(cache.has(ObjectID(uint64_t(2))));
+	CHECK(cache.has(ObjectID(uint64_t(3))));
+	CHECK(cache.has(ObjectID(uint64_t(4))));
+	CHECK(cache.get_size() == sizeof(AudioFrame) * 300);
+
+	// Making room for a larger stream evicts as many streams as needed, oldest first.
+	cache.insert(ObjectID(uint64_t(5)), make_frames(150));
+	CHECK_FALSE(cache.has(ObjectID(uint64_t(1))));
+	CHECK_FALSE(cache.has(ObjectID(uint64_t(3))));
+	CHECK(cache.has(ObjectID(uint64_t(4))));
+	CHECK(cache.has(ObjectID(uint64_t(5))));
+	CHECK(cache.get_size() == sizeof(AudioFrame) * 250);
+
+	// Shrinking the cache evicts too.
+	cache.set_max_size(sizeof(AudioFrame) * 200);
+	CHECK_FALSE(cache.has(ObjectID(uint64_t(4))));
+	CHECK(cache.has(ObjectID(uint64_t(5))));
+	CHECK(cache.get_size() == sizeof(AudioFrame) * 150);
+}
+
+TEST_CASE("[AudioStreamOggVorbis] Setting the packet sequence drops the cached PCM") {
+	OggVorbisPCMCache &cache = AudioStreamOggVorbis::get_pcm_cache();
+	uint64_t max_size = cache.get_max_size();
+	cache.set_max_size(sizeof(AudioFrame) * 1000);
+
+	Ref<AudioStreamOggVorbis> stream;
+	stream.instantiate();
+	Ref<AudioStreamOggVorbis> other_stream;
+	other_stream.instantiate();
+	cache.insert(stream->get_instance_id(), make_frames(100));
+	cache.insert(other_stream->get_instance_id(), make_frames(100));
+
+	stream->set_packet_sequence(Ref<OggPacketSequence>());
+	CHECK_FALSE(cache.has(stream->get_instance_id()));
+	CHECK(cache.has(other_stream->get_instance_id()));
+	CHECK(cache.get_size() == sizeof(AudioFrame) * 100);
+
+	other_stream.unref();
+	CHECK(cache.get_size() == 0);
+
+	cache.set_max_size(max_size);
+}
+
+} // namespace TestAudioStreamOggVorbis
+
+#endif // TEST_AUDIO_STREAM_OGG_VORBIS_H
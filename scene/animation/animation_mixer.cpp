@@ -31,6 +31,7 @@
 #include "animation_mixer.h"
 
 #include "core/config/engine.h"
+#include "core/object/worker_thread_pool.h"
 #include "scene/animation/animation_player.h"
 #include "scene/resources/animation.h"
 #include "scene/scene_string_names.h"
@@ -41,6 +42,9 @@
 #include "editor/editor_undo_redo_manager.h"
 #endif // TOOLS_ENABLED
 
+bool AnimationMixer::parallel_processing = false;
+LocalVector<ObjectID> AnimationMixer::parallel_mixers;
+
 bool AnimationMixer::_set(const StringName &p_name, const Variant &p_value) {
 	String name = p_name;
 
@@ -547,8 +551,16 @@ void AnimationMixer::_clear_caches() {
 		memdelete(K.value);
 	}
 	track_cache.clear();
+	animation_tracks.clear();
 	cache_valid = false;
 
+	if (parallel_blend_pending) {
+		// The caches it was blending into are gone.
+		parallel_blend_pending = false;
+		parallel_blend_done = false;
+		clear_animation_instances();
+	}
+
 	emit_signal(SNAME("caches_cleared"));
 }
 
@@ -583,6 +595,7 @@ void AnimationMixer::_init_root_motion_cache() {
 
 bool AnimationMixer::_update_caches() {
 	setup_pass++;
+	animation_tracks.clear();
 
 	root_motion_cache.loc = Vector3(0, 0, 0);
 	root_motion_cache.rot = Quaternion(0, 0, 0, 1);
@@ -918,6 +931,7 @@ bool AnimationMixer::_update_caches() {
 	int idx = 0;
 	for (const KeyValue<NodePath, TrackCache *> &K : track_cache) {
 		track_map[K.key] = idx;
+		K.value->blend_idx = idx;
 		idx++;
 	}
 
@@ -928,11 +942,34 @@ bool AnimationMixer::_update_caches() {
 	return true;
 }
 
+AnimationMixer::AnimationTracks &AnimationMixer::_get_animation_tracks(const Ref<Animation> &p_animation) {
+	AnimationTracks *tracks = animation_tracks.getptr(p_animation->get_instance_id());
+	if (tracks && tracks->track_caches.size() == (uint32_t)p_animation->get_track_count()) {
+		return *tracks;
+	}
+
+	if (!tracks) {
+		tracks = &animation_tracks.insert(p_animation->get_instance_id(), AnimationTracks())->value;
+	}
+	tracks->track_caches.resize(p_animation->get_track_count());
+	for (int i = 0; i < p_animation->get_track_count(); i++) {
+		HashMap<NodePath, TrackCache *>::Iterator E = track_cache.find(p_animation->track_get_path(i));
+		tracks->track_caches[i] = E ? E->value : nullptr;
+	}
+	tracks->cursors.clear();
+	tracks->cursors.resize(p_animation->get_track_count());
+	return *tracks;
+}
+
 /* -------------------------------------------- */
 /* -- Blending processor ---------------------- */
 /* -------------------------------------------- */
 
 void AnimationMixer::_process_animation(double p_delta, bool p_update_only) {
+	if (parallel_blend_pending) {
+		_flush_parallel_blend();
+	}
+
 	_blend_init();
 	if (_blend_pre_process(p_delta, track_count, track_map)) {
 		_blend_calc_total_weight();
@@ -943,9 +980,120 @@ void AnimationMixer::_process_animation(double p_delta, bool p_update_only) {
 	clear_animation_instances();
 }
 
+/* -------------------------------------------- */
+/* -- Parallel processing --------------------- */
+/* -------------------------------------------- */
+
+bool AnimationMixer::_can_process_in_parallel() {
+	// Mixers processed in sub-thread groups are already run in parallel, and a script post-processing
+	// key values can't be called from other threads.
+	return parallel_processing && Thread::is_main_thread() && !GDVIRTUAL_IS_OVERRIDDEN(_post_process_key_value);
+}
+
+void AnimationMixer::_process_animation_parallel(double p_delta) {
+	if (parallel_blend_pending) {
+		_flush_parallel_blend();
+	}
+
+	_blend_init();
+	if (!_blend_pre_process(p_delta, track_count, track_map)) {
+		clear_animation_instances();
+		return;
+	}
+	_blend_calc_total_weight();
+
+	// Tracks with side effects (calling methods, playing audio, setting discrete values...) are processed now.
+	// Transform tracks are blended later along the ones of the other mixers processed in this frame.
+	_blend_process(p_delta, false, BLEND_TRACKS_OTHER);
+	parallel_blend_pending = true;
+	parallel_blend_done = false;
+	parallel_blend_delta = p_delta;
+
+	if (!parallel_blend_queued) {
+		if (parallel_mixers.is_empty()) {
+			callable_mp_static(&AnimationMixer::_process_parallel_mixers).call_deferred();
+		}
+		parallel_mixers.push_back(get_instance_id());
+		parallel_blend_queued = true;
+	}
+}
+
+void AnimationMixer::_flush_parallel_blend() {
+	if (!parallel_blend_done) {
+		_blend_process(parallel_blend_delta, false, BLEND_TRACKS_TRANSFORM);
+	}
+	_finish_parallel_blend();
+}
+
+void AnimationMixer::_finish_parallel_blend() {
+	parallel_blend_pending = false;
+	parallel_blend_done = false;
+	_blend_apply();
+	_blend_post_process();
+	clear_animation_instances();
+}
+
+void AnimationMixer::_parallel_blend_task(void *p_userdata, uint32_t p_index) {
+	AnimationMixer *mixer = ((AnimationMixer **)p_userdata)[p_index];
+	mixer->blending_in_parallel = true;
+	mixer->_blend_process(mixer->parallel_blend_delta, false, BLEND_TRACKS_TRANSFORM);
+	mixer->blending_in_parallel = false;
+	mixer->parallel_blend_done = true;
+}
+
+void AnimationMixer::_process_parallel_mixers() {
+	LocalVector<AnimationMixer *> mixers;
+	LocalVector<ObjectID> mixer_ids;
+	mixers.reserve(parallel_mixers.size());
+	mixer_ids.reserve(parallel_mixers.size());
+	for (const ObjectID &id : parallel_mixers) {
+		AnimationMixer *mixer = Object::cast_to<AnimationMixer>(ObjectDB::get_instance(id));
+		if (!mixer) {
+			continue; // Freed in the meantime.
+		}
+		mixer->parallel_blend_queued = false;
+		if (mixer->parallel_blend_pending) {
+			mixers.push_back(mixer);
+			mixer_ids.push_back(id);
+		}
+	}
+	parallel_mixers.clear();
+
+	if (mixers.is_empty()) {
+		return;
+	}
+
+	// Blending only reads animations and writes to the track caches of each mixer, so mixers can be blended
+	// at the same time. The results are applied to the nodes afterwards, in the order mixers were processed.
+	if (mixers.size() == 1) {
+		_parallel_blend_task(mixers.ptr(), 0);
+	} else {
+		WorkerThreadPool::GroupID group_task = WorkerThreadPool::get_singleton()->add_native_group_task(&AnimationMixer::_parallel_blend_task, mixers.ptr(), mixers.size(), -1, true, SNAME("AnimationMixerBlend"));
+		WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group_task);
+	}
+
+	// Signals emitted while applying may free, seek or process any of the mixers, which then have
+	// already been applied or were processed again.
+	for (const ObjectID &id : mixer_ids) {
+		AnimationMixer *mixer = Object::cast_to<AnimationMixer>(ObjectDB::get_instance(id));
+		if (mixer && mixer->parallel_blend_pending && mixer->parallel_blend_done) {
+			mixer->_finish_parallel_blend();
+		}
+	}
+}
+
+void AnimationMixer::set_parallel_processing_enabled(bool p_enabled) {
+	parallel_processing = p_enabled;
+}
+
+bool AnimationMixer::is_parallel_processing_enabled() {
+	return parallel_processing;
+}
+
 Variant AnimationMixer::post_process_key_value(const Ref<Animation> &p_anim, int p_track, Variant p_value, const Object *p_object, int p_object_idx) {
 	Variant res;
-	if (GDVIRTUAL_CALL(_post_process_key_value, p_anim, p_track, p_value, const_cast<Object *>(p_object), p_object_idx, res)) {
+	// Not overridden when blending in parallel, see _can_process_in_parallel().
+	if (!blending_in_parallel && GDVIRTUAL_CALL(_post_process_key_value, p_anim, p_track, p_value, const_cast<Object *>(p_object), p_object_idx, res)) {
 		return res;
 	}
 	return _post_process_key_value(p_anim, p_track, p_value, p_object, p_object_idx);
@@ -1036,33 +1184,41 @@ void AnimationMixer::_blend_post_process() {
 }
 
 void AnimationMixer::_blend_calc_total_weight() {
-	for (const AnimationInstance &ai : animation_instances) {
+	// Tracks of different types can share the same path (e.g. position, rotation and scale),
+	// so remember the last instance which added its weight to each track cache.
+	LocalVector<int> processed_by;
+	processed_by.resize(track_count);
+	for (int &E : processed_by) {
+		E = -1;
+	}
+
+	for (uint32_t ai_idx = 0; ai_idx < animation_instances.size(); ai_idx++) {
+		const AnimationInstance &ai = animation_instances[ai_idx];
 		Ref<Animation> a = ai.animation_data.animation;
 		real_t weight = ai.playback_info.weight;
-		Vector<real_t> track_weights = ai.playback_info.track_weights;
-		Vector<int> processed_indices;
+		const Vector<real_t> &track_weights = ai.playback_info.track_weights;
+		const LocalVector<TrackCache *> &track_num_to_track_cache = _get_animation_tracks(a).track_caches;
 		for (int i = 0; i < a->get_track_count(); i++) {
 			if (!a->track_is_enabled(i)) {
 				continue;
 			}
-			NodePath path = a->track_get_path(i);
-			if (!track_cache.has(path)) {
+			TrackCache *track = track_num_to_track_cache[i];
+			if (!track) {
 				continue; // No path, but avoid error spamming.
 			}
-			TrackCache *track = track_cache[path];
-			int blend_idx = track_map[path];
-			if (processed_indices.has(blend_idx)) {
-				continue; // There is the case different track type with same path... Is there more faster iterating way than has()?
-			}
+			int blend_idx = track->blend_idx;
 			ERR_CONTINUE(blend_idx < 0 || blend_idx >= track_count);
+			if (processed_by[blend_idx] == (int)ai_idx) {
+				continue;
+			}
 			real_t blend = blend_idx < track_weights.size() ? track_weights[blend_idx] * weight : weight;
 			track->total_weight += blend;
-			processed_indices.push_back(blend_idx);
+			processed_by[blend_idx] = ai_idx;
 		}
 	}
 }
 
-void AnimationMixer::_blend_process(double p_delta, bool p_update_only) {
+void AnimationMixer::_blend_process(double p_delta, bool p_update_only, BlendTrackFilter p_filter) {
 	// Apply value/transform/blend/bezier blends to track caches and execute method/audio/animation tracks.
 #ifdef TOOLS_ENABLED
 	bool can_call = is_inside_tree() && !Engine::get_singleton()->is_editor_hint();
@@ -1075,7 +1231,10 @@ void AnimationMixer::_blend_process(double p_delta, bool p_update_only) {
 		Animation::LoopedFlag looped_flag = ai.playback_info.looped_flag;
 		bool is_external_seeking = ai.playback_info.is_external_seeking;
 		real_t weight = ai.playback_info.weight;
-		Vector<real_t> track_weights = ai.playback_info.track_weights;
+		const Vector<real_t> &track_weights = ai.playback_info.track_weights;
+		AnimationTracks &animation_tracks_data = _get_animation_tracks(a);
+		const LocalVector<TrackCache *> &track_num_to_track_cache = animation_tracks_data.track_caches;
+		Animation::TrackCursor *track_cursors = animation_tracks_data.cursors.ptr();
 		bool backward = signbit(delta); // This flag is used by the root motion calculates or detecting the end of audio stream.
 #ifndef _3D_DISABLED
 		bool calc_root = !seeked || is_external_seeking;
@@ -1085,13 +1244,11 @@ void AnimationMixer::_blend_process(double p_delta, bool p_update_only) {
 			if (!a->track_is_enabled(i)) {
 				continue;
 			}
-			NodePath path = a->track_get_path(i);
-			if (!track_cache.has(path)) {
+			TrackCache *track = track_num_to_track_cache[i];
+			if (!track) {
 				continue; // No path, but avoid error spamming.
 			}
-			TrackCache *track = track_cache[path];
-			ERR_CONTINUE(!track_map.has(path));
-			int blend_idx = track_map[path];
+			int blend_idx = track->blend_idx;
 			ERR_CONTINUE(blend_idx < 0 || blend_idx >= track_count);
 			real_t blend = blend_idx < track_weights.size() ? track_weights[blend_idx] * weight : weight;
 			if (!deterministic) {
@@ -1107,7 +1264,13 @@ void AnimationMixer::_blend_process(double p_delta, bool p_update_only) {
 				// Broken animation, but avoid error spamming.
 				continue;
 			}
-			track->root_motion = root_motion_track == path;
+			if (p_filter != BLEND_TRACKS_ALL) {
+				bool is_transform = ttype == Animation::TYPE_POSITION_3D || ttype == Animation::TYPE_ROTATION_3D || ttype == Animation::TYPE_SCALE_3D || ttype == Animation::TYPE_BLEND_SHAPE || ttype == Animation::TYPE_BEZIER;
+				if (is_transform != (p_filter == BLEND_TRACKS_TRANSFORM)) {
+					continue;
+				}
+			}
+			track->root_motion = !root_motion_track.is_empty() && root_motion_track == a->track_get_path(i);
 			switch (ttype) {
 				case Animation::TYPE_POSITION_3D: {
 #ifndef _3D_DISABLED
@@ -1188,7 +1351,7 @@ void AnimationMixer::_blend_process(double p_delta, bool p_update_only) {
 					}
 					{
 						Vector3 loc;
-						Error err = a->try_position_track_interpolate(i, time, &loc);
+						Error err = a->try_position_track_interpolate(i, time, &loc, &track_cursors[i]);
 						if (err != OK) {
 							continue;
 						}
@@ -1275,7 +1438,7 @@ void AnimationMixer::_blend_process(double p_delta, bool p_update_only) {
 					}
 					{
 						Quaternion rot;
-						Error err = a->try_rotation_track_interpolate(i, time, &rot);
+						Error err = a->try_rotation_track_interpolate(i, time, &rot, &track_cursors[i]);
 						if (err != OK) {
 							continue;
 						}
@@ -1363,7 +1526,7 @@ void AnimationMixer::_blend_process(double p_delta, bool p_update_only) {
 					}
 					{
 						Vector3 scale;
-						Error err = a->try_scale_track_interpolate(i, time, &scale);
+						Error err = a->try_scale_track_interpolate(i, time, &scale, &track_cursors[i]);
 						if (err != OK) {
 							continue;
 						}
@@ -1379,7 +1542,7 @@ void AnimationMixer::_blend_process(double p_delta, bool p_update_only) {
 					}
 					TrackCacheBlendShape *t = static_cast<TrackCacheBlendShape *>(track);
 					float value;
-					Error err = a->try_blend_shape_track_interpolate(i, time, &value);
+					Error err = a->try_blend_shape_track_interpolate(i, time, &value, &track_cursors[i]);
 					//ERR_CONTINUE(err!=OK); //used for testing, should be removed
 					if (err != OK) {
 						continue;
@@ -1989,6 +2152,7 @@ void AnimationMixer::restore(const Ref<AnimatedValuesBackup> &p_backup) {
 	track_cache = p_backup->get_data();
 	_blend_apply();
 	track_cache = HashMap<NodePath, AnimationMixer::TrackCache *>();
+	animation_tracks.clear();
 	cache_valid = false;
 }
 
@@ -2037,13 +2201,21 @@ void AnimationMixer::_notification(int p_what) {
 
 		case NOTIFICATION_INTERNAL_PROCESS: {
 			if (active && callback_mode_process == ANIMATION_CALLBACK_MODE_PROCESS_IDLE) {
-				_process_animation(get_process_delta_time());
+				if (_can_process_in_parallel()) {
+					_process_animation_parallel(get_process_delta_time());
+				} else {
+					_process_animation(get_process_delta_time());
+				}
 			}
 		} break;
 
 		case NOTIFICATION_INTERNAL_PHYSICS_PROCESS: {
 			if (active && callback_mode_process == ANIMATION_CALLBACK_MODE_PROCESS_PHYSICS) {
-				_process_animation(get_physics_process_delta_time());
+				if (_can_process_in_parallel()) {
+					_process_animation_parallel(get_physics_process_delta_time());
+				} else {
+					_process_animation(get_physics_process_delta_time());
+				}
 			}
 		} break;
 
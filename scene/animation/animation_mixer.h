@@ -141,6 +141,7 @@ protected:
 		Object *object = nullptr;
 		ObjectID object_id;
 		real_t total_weight = 0.0;
+		int blend_idx = -1; // Index in track_map, resolved when caches are updated.
 
 		TrackCache() = default;
 		TrackCache(const TrackCache &p_other) :
@@ -149,7 +150,8 @@ protected:
 				type(p_other.type),
 				object(p_other.object),
 				object_id(p_other.object_id),
-				total_weight(p_other.total_weight) {}
+				total_weight(p_other.total_weight),
+				blend_idx(p_other.blend_idx) {}
 
 		virtual ~TrackCache() {}
 	};
@@ -324,8 +326,34 @@ protected:
 	LocalVector<AnimationInstance> animation_instances;
 	HashMap<NodePath, int> track_map;
 	int track_count = 0;
+
 	bool deterministic = false;
 
+	// Track caches of each animation indexed by track number, so blending doesn't look up paths every frame,
+	// and where each track was last sampled, so playing forward doesn't search the keys every frame.
+	struct AnimationTracks {
+		LocalVector<TrackCache *> track_caches;
+		LocalVector<Animation::TrackCursor> cursors;
+	};
+	HashMap<ObjectID, AnimationTracks> animation_tracks;
+	AnimationTracks &_get_animation_tracks(const Ref<Animation> &p_animation);
+
+	/* ---- Parallel processing ---- */
+	static bool parallel_processing;
+	static LocalVector<ObjectID> parallel_mixers; // Mixers waiting for their tracks to be blended, in processing order.
+	bool parallel_blend_queued = false;
+	bool parallel_blend_pending = false;
+	bool parallel_blend_done = false; // Transform tracks were already blended, only applying them is left.
+	bool blending_in_parallel = false;
+	double parallel_blend_delta = 0.0;
+
+	bool _can_process_in_parallel();
+	void _process_animation_parallel(double p_delta);
+	void _flush_parallel_blend();
+	void _finish_parallel_blend();
+	static void _parallel_blend_task(void *p_userdata, uint32_t p_index);
+	static void _process_parallel_mixers();
+
 	/* ---- Root motion accumulator for Skeleton3D ---- */
 	NodePath root_motion_track;
 	Vector3 root_motion_position = Vector3(0, 0, 0);
@@ -358,7 +386,12 @@ protected:
 	void _blend_init();
 	virtual bool _blend_pre_process(double p_delta, int p_track_count, const HashMap<NodePath, int> &p_track_map);
 	void _blend_calc_total_weight(); // For undeterministic blending.
-	void _blend_process(double p_delta, bool p_update_only = false);
+	enum BlendTrackFilter {
+		BLEND_TRACKS_ALL,
+		BLEND_TRACKS_TRANSFORM, // Position, rotation, scale, blend shape and bezier tracks, which only write to the track caches.
+		BLEND_TRACKS_OTHER,
+	};
+	void _blend_process(double p_delta, bool p_update_only = false, BlendTrackFilter p_filter = BLEND_TRACKS_ALL);
 	void _blend_apply();
 	virtual void _blend_post_process();
 	void _call_object(Object *p_object, const StringName &p_method, const Vector<Variant> &p_params, bool p_deferred);
@@ -420,6 +453,9 @@ public:
 	void set_reset_on_save_enabled(bool p_enabled);
 	bool is_reset_on_save_enabled() const;
 
+	static void set_parallel_processing_enabled(bool p_enabled);
+	static bool is_parallel_processing_enabled();
+
 	bool can_apply_reset() const;
 	void _build_backup_track_cache();
 	Ref<AnimatedValuesBackup> make_backup();
@@ -177,11 +177,11 @@ double AnimationNode::_blend_node(Ref<AnimationNode> p_node, const StringName &p
 		}
 
 		for (const KeyValue<NodePath, bool> &E : filter) {
-			if (!process_state->track_map.has(E.key)) {
+			const int *idx = process_state->track_map->getptr(E.key);
+			if (!idx) {
 				continue;
 			}
-			int idx = process_state->track_map[E.key];
-			blendw[idx] = 1.0; // Filtered goes to one.
+			blendw[*idx] = 1.0; // Filtered goes to one.
 		}
 
 		switch (p_filter) {
@@ -546,7 +546,7 @@ bool AnimationTree::_blend_pre_process(double p_delta, int p_track_count, const
 		process_state.valid = true;
 		process_state.invalid_reasons = "";
 		process_state.last_pass = process_pass;
-		process_state.track_map = p_track_map;
+		process_state.track_map = &p_track_map;
 
 		// Init node state for root AnimationNode.
 		root_animation_node->node_state.track_weights.resize(p_track_count);
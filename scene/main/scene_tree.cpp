@@ -899,10 +899,14 @@ void SceneTree::_process_group(ProcessGroup *p_group, bool p_physics) {
 	// When reading this function, keep in mind that this code must work in a way where
 	// if any node is removed, this needs to continue working.
 
+	uint64_t begin_usec = OS::get_singleton()->get_ticks_usec();
+	uint64_t &time_usec = p_physics ? p_group->physics_process_time_usec : p_group->process_time_usec;
+
 	p_group->call_queue.flush(); // Flush messages before processing.
 
 	Vector<Node *> &nodes = p_physics ? p_group->physics_nodes : p_group->nodes;
 	if (nodes.is_empty()) {
+		time_usec = OS::get_singleton()->get_ticks_usec() - begin_usec;
 		return;
 	}
 
@@ -954,12 +958,28 @@ void SceneTree::_process_group(ProcessGroup *p_group, bool p_physics) {
 	}
 
 	p_group->call_queue.flush(); // Flush messages also after processing (for potential deferred calls).
+
+	time_usec = OS::get_singleton()->get_ticks_usec() - begin_usec;
+}
+
+void SceneTree::_process_claimed_groups(bool p_physics) {
+	// Groups are not bound to task indices. Whoever is free claims the next one, in priority order,
+	// so a few heavy groups don't leave threads idle while others wait in line.
+	uint32_t group_count = local_process_group_cache.size();
+	while (true) {
+		uint32_t index = local_process_group_cursor.postincrement();
+		if (index >= group_count) {
+			break;
+		}
+		ProcessGroup *pg = local_process_group_cache[index];
+		Node::current_process_thread_group = pg->owner;
+		_process_group(pg, p_physics);
+		Node::current_process_thread_group = nullptr;
+	}
 }
 
 void SceneTree::_process_groups_thread(uint32_t p_index, bool p_physics) {
-	Node::current_process_thread_group = local_process_group_cache[p_index]->owner;
-	_process_group(local_process_group_cache[p_index], p_physics);
-	Node::current_process_thread_group = nullptr;
+	_process_claimed_groups(p_physics);
 }
 
 void SceneTree::_process(bool p_physics) {
@@ -983,18 +1003,30 @@ void SceneTree::_process(bool p_physics) {
 				process_groups.resize(pg_count);
 			}
 		}
-		{
-			// Then, re-sort groups.
-			process_groups.sort_custom<ProcessGroupSort>();
-		}
-
 		process_groups_dirty = false;
+		// Then, force a re-sort of the groups below.
+		process_groups_sorted = false;
+		physics_process_groups_sorted = false;
+	}
+
+	// Groups of the same order run by owner priority, which differs between process and physics process.
+	// Each keeps its own order, so they are only sorted again after the groups changed.
+	if (p_physics) {
+		if (!physics_process_groups_sorted) {
+			physics_process_groups = process_groups;
+			physics_process_groups.sort_custom<PhysicsProcessGroupSort>();
+			physics_process_groups_sorted = true;
+		}
+	} else if (!process_groups_sorted) {
+		process_groups.sort_custom<ProcessGroupSort>();
+		process_groups_sorted = true;
 	}
+	LocalVector<ProcessGroup *> &groups = p_physics ? physics_process_groups : process_groups;
 
 	// Cache the group count, because during processing new groups may be added.
 	// They will be added at the end, hence for consistency they will be ignored by this process loop.
 	// No group will be removed from the array during processing (this is done earlier in this function by marking the groups dirty).
-	uint32_t group_count = process_groups.size();
+	uint32_t group_count = groups.size();
 
 	if (group_count == 0) {
 		return;
@@ -1003,36 +1035,45 @@ void SceneTree::_process(bool p_physics) {
 	process_last_pass++; // Increment pass
 	uint32_t from = 0;
 	uint32_t process_count = 0;
+	uint64_t group_time_max_usec = 0;
 	nodes_removed_on_group_call_lock++;
 
-	int current_order = process_groups[0]->owner ? process_groups[0]->owner->data.process_thread_group_order : 0;
-	bool current_threaded = process_groups[0]->owner ? process_groups[0]->owner->data.process_thread_group == Node::PROCESS_THREAD_GROUP_SUB_THREAD : false;
+	int current_order = groups[0]->owner ? groups[0]->owner->data.process_thread_group_order : 0;
+	bool current_threaded = groups[0]->owner ? groups[0]->owner->data.process_thread_group == Node::PROCESS_THREAD_GROUP_SUB_THREAD : false;
 
 	for (uint32_t i = 0; i <= group_count; i++) {
-		int order = i < group_count && process_groups[i]->owner ? process_groups[i]->owner->data.process_thread_group_order : 0;
-		bool threaded = i < group_count && process_groups[i]->owner ? process_groups[i]->owner->data.process_thread_group == Node::PROCESS_THREAD_GROUP_SUB_THREAD : false;
+		int order = i < group_count && groups[i]->owner ? groups[i]->owner->data.process_thread_group_order : 0;
+		bool threaded = i < group_count && groups[i]->owner ? groups[i]->owner->data.process_thread_group == Node::PROCESS_THREAD_GROUP_SUB_THREAD : false;
 
 		if (i == group_count || current_order != order || current_threaded != threaded) {
 			if (process_count > 0) {
 				// Proceed to process the group.
-				bool using_threads = process_groups[from]->owner && process_groups[from]->owner->data.process_thread_group == Node::PROCESS_THREAD_GROUP_SUB_THREAD && !node_threading_disabled;
+				bool using_threads = groups[from]->owner && groups[from]->owner->data.process_thread_group == Node::PROCESS_THREAD_GROUP_SUB_THREAD && !node_threading_disabled;
 
 				if (using_threads) {
 					local_process_group_cache.clear();
 				}
 				for (uint32_t j = from; j < i; j++) {
-					if (process_groups[j]->last_pass == process_last_pass) {
+					if (groups[j]->last_pass == process_last_pass) {
 						if (using_threads) {
-							local_process_group_cache.push_back(process_groups[j]);
+							local_process_group_cache.push_back(groups[j]);
 						} else {
-							_process_group(process_groups[j], p_physics);
+							_process_group(groups[j], p_physics);
+							group_time_max_usec = MAX(group_time_max_usec, p_physics ? groups[j]->physics_process_time_usec : groups[j]->process_time_usec);
 						}
 					}
 				}
 
-				if (using_threads) {
-					WorkerThreadPool::GroupID id = WorkerThreadPool::get_singleton()->add_template_group_task(this, &SceneTree::_process_groups_thread, p_physics, local_process_group_cache.size(), -1, true);
+				if (using_threads && !local_process_group_cache.is_empty()) {
+					local_process_group_cursor.set(0);
+					// The main thread only waits here. Node guards rely on Thread::is_main_thread(), so running
+					// sub-thread groups on it would let their code free or reparent nodes while workers process.
+					WorkerThreadPool::GroupID id = WorkerThreadPool::get_singleton()->add_template_group_task(this, &SceneTree::_process_groups_thread, p_physics, local_process_group_cache.size(), -1, true, SNAME("ProcessGroups"));
 					WorkerThreadPool::get_singleton()->wait_for_group_task_completion(id);
+
+					for (const ProcessGroup *pg : local_process_group_cache) {
+						group_time_max_usec = MAX(group_time_max_usec, p_physics ? pg->physics_process_time_usec : pg->process_time_usec);
+					}
 				}
 			}
 
@@ -1046,11 +1087,11 @@ void SceneTree::_process(bool p_physics) {
 			current_order = order;
 		}
 
-		if (process_groups[i]->removed) {
+		if (groups[i]->removed) {
 			continue;
 		}
 
-		ProcessGroup *pg = process_groups[i];
+		ProcessGroup *pg = groups[i];
 
 		// Validate group for processing
 		bool process_valid = false;
@@ -1078,19 +1119,38 @@ void SceneTree::_process(bool p_physics) {
 	if (nodes_removed_on_group_call_lock == 0) {
 		nodes_removed_on_group_call.clear();
 	}
+
+	if (p_physics) {
+		physics_process_group_time_max_usec = group_time_max_usec;
+	} else {
+		process_group_time_max_usec = group_time_max_usec;
+	}
 }
 
-bool SceneTree::ProcessGroupSort::operator()(const ProcessGroup *p_left, const ProcessGroup *p_right) const {
+bool SceneTree::_compare_process_groups(const ProcessGroup *p_left, const ProcessGroup *p_right, bool p_physics) {
 	int left_order = p_left->owner ? p_left->owner->data.process_thread_group_order : 0;
 	int right_order = p_right->owner ? p_right->owner->data.process_thread_group_order : 0;
 
-	if (left_order == right_order) {
-		int left_threaded = p_left->owner != nullptr && p_left->owner->data.process_thread_group == Node::PROCESS_THREAD_GROUP_SUB_THREAD ? 0 : 1;
-		int right_threaded = p_right->owner != nullptr && p_right->owner->data.process_thread_group == Node::PROCESS_THREAD_GROUP_SUB_THREAD ? 0 : 1;
-		return left_threaded < right_threaded;
-	} else {
+	if (left_order != right_order) {
 		return left_order < right_order;
 	}
+
+	int left_threaded = p_left->owner != nullptr && p_left->owner->data.process_thread_group == Node::PROCESS_THREAD_GROUP_SUB_THREAD ? 0 : 1;
+	int right_threaded = p_right->owner != nullptr && p_right->owner->data.process_thread_group == Node::PROCESS_THREAD_GROUP_SUB_THREAD ? 0 : 1;
+	if (left_threaded != right_threaded) {
+		return left_threaded < right_threaded;
+	}
+
+	// Within the same order, groups follow the priority of their owner, like nodes within a group do.
+	int left_priority = 0;
+	int right_priority = 0;
+	if (p_left->owner) {
+		left_priority = p_physics ? p_left->owner->data.physics_process_priority : p_left->owner->data.process_priority;
+	}
+	if (p_right->owner) {
+		right_priority = p_physics ? p_right->owner->data.physics_process_priority : p_right->owner->data.process_priority;
+	}
+	return left_priority < right_priority;
 }
 
 void SceneTree::_remove_process_group(Node *p_node) {
@@ -1137,6 +1197,11 @@ void SceneTree::_add_node_to_process_group(Node *p_node, Node *p_owner) {
 	_THREAD_SAFE_METHOD_
 	ProcessGroup *pg = p_owner ? (ProcessGroup *)p_owner->data.process_group : &default_process_group;
 
+	if (p_node == p_owner) {
+		// The owner priority may have changed, which affects the group order.
+		process_groups_dirty = true;
+	}
+
 	if (p_node->is_processing() || p_node->is_processing_internal()) {
 		pg->nodes.push_back(p_node);
 		pg->node_order_dirty = true;
@@ -1359,6 +1424,14 @@ int SceneTree::get_node_count() const {
 	return nodes_in_tree_count;
 }
 
+int SceneTree::get_process_group_count() const {
+	return process_groups.size();
+}
+
+uint64_t SceneTree::get_process_group_time_max_usec(bool p_physics) const {
+	return p_physics ? physics_process_group_time_max_usec : process_group_time_max_usec;
+}
+
 void SceneTree::set_edited_scene_root(Node *p_node) {
 #ifdef TOOLS_ENABLED
 	edited_scene_root = p_node;
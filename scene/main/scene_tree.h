@@ -34,6 +34,7 @@
 #include "core/os/main_loop.h"
 #include "core/os/thread_safe.h"
 #include "core/templates/paged_allocator.h"
+#include "core/templates/safe_refcount.h"
 #include "core/templates/self_list.h"
 #include "scene/resources/mesh.h"
 
@@ -98,18 +99,32 @@ private:
 		bool removed = false;
 		Node *owner = nullptr;
 		uint64_t last_pass = 0;
+		uint64_t process_time_usec = 0; // Time spent in the last pass, for monitoring.
+		uint64_t physics_process_time_usec = 0;
 	};
 
+	static bool _compare_process_groups(const ProcessGroup *p_left, const ProcessGroup *p_right, bool p_physics);
+
 	struct ProcessGroupSort {
-		_FORCE_INLINE_ bool operator()(const ProcessGroup *p_left, const ProcessGroup *p_right) const;
+		_FORCE_INLINE_ bool operator()(const ProcessGroup *p_left, const ProcessGroup *p_right) const { return _compare_process_groups(p_left, p_right, false); }
+	};
+
+	struct PhysicsProcessGroupSort {
+		_FORCE_INLINE_ bool operator()(const ProcessGroup *p_left, const ProcessGroup *p_right) const { return _compare_process_groups(p_left, p_right, true); }
 	};
 
 	PagedAllocator<ProcessGroup, true> group_allocator; // Allocate groups on pages, to enhance cache usage.
 
-	LocalVector<ProcessGroup *> process_groups;
+	LocalVector<ProcessGroup *> process_groups; // Ordered by process priority.
+	LocalVector<ProcessGroup *> physics_process_groups; // The same groups, ordered by physics priority.
 	bool process_groups_dirty = true;
+	bool process_groups_sorted = false;
+	bool physics_process_groups_sorted = false;
 	LocalVector<ProcessGroup *> local_process_group_cache; // Used when processing to group what needs to
+	SafeNumeric<uint32_t> local_process_group_cursor; // Next group in the cache to be claimed by a thread.
 	uint64_t process_last_pass = 1;
+	uint64_t process_group_time_max_usec = 0;
+	uint64_t physics_process_group_time_max_usec = 0;
 
 	ProcessGroup default_process_group;
 
@@ -217,6 +232,7 @@ private:
 
 	void _process_group(ProcessGroup *p_group, bool p_physics);
 	void _process_groups_thread(uint32_t p_index, bool p_physics);
+	void _process_claimed_groups(bool p_physics);
 	void _process(bool p_physics);
 
 	void _remove_process_group(Node *p_node);
@@ -379,6 +395,9 @@ public:
 	int64_t get_frame() const;
 
 	int get_node_count() const;
+	int get_process_group_count() const;
+	// Time taken by the slowest process group in the last pass, which bounds how well groups run in parallel.
+	uint64_t get_process_group_time_max_usec(bool p_physics) const;
 
 	void queue_delete(Object *p_object);
 
@@ -1177,6 +1177,8 @@ void register_scene_types() {
 		GLOBAL_DEF_BASIC(vformat("%s/layer_%d", PNAME("layer_names/avoidance"), i + 1), "");
 	}
 
+	AnimationMixer::set_parallel_processing_enabled(GLOBAL_DEF("animation/mixers/parallel_processing", false));
+
 	if (RenderingServer::get_singleton()) {
 		ColorPicker::init_shaders(); // RenderingServer needs to exist for this to succeed.
 	}
@@ -1093,7 +1093,7 @@ Error Animation::position_track_get_key(int p_track, int p_key, Vector3 *r_posit
 	return OK;
 }
 
-Error Animation::try_position_track_interpolate(int p_track, double p_time, Vector3 *r_interpolation) const {
+Error Animation::try_position_track_interpolate(int p_track, double p_time, Vector3 *r_interpolation, TrackCursor *r_cursor) const {
 	ERR_FAIL_INDEX_V(p_track, tracks.size(), ERR_INVALID_PARAMETER);
 	Track *t = tracks[p_track];
 	ERR_FAIL_COND_V(t->type != TYPE_POSITION_3D, ERR_INVALID_PARAMETER);
@@ -1101,7 +1101,7 @@ Error Animation::try_position_track_interpolate(int p_track, double p_time, Vect
 	PositionTrack *tt = static_cast<PositionTrack *>(t);
 
 	if (tt->compressed_track >= 0) {
-		if (_pos_scale_interpolate_compressed(tt->compressed_track, p_time, *r_interpolation)) {
+		if (_pos_scale_interpolate_compressed(tt->compressed_track, p_time, *r_interpolation, r_cursor)) {
 			return OK;
 		} else {
 			return ERR_UNAVAILABLE;
@@ -1110,7 +1110,7 @@ Error Animation::try_position_track_interpolate(int p_track, double p_time, Vect
 
 	bool ok = false;
 
-	Vector3 tk = _interpolate(tt->positions, p_time, tt->interpolation, tt->loop_wrap, &ok);
+	Vector3 tk = _interpolate(tt->positions, p_time, tt->interpolation, tt->loop_wrap, &ok, false, r_cursor);
 
 	if (!ok) {
 		return ERR_UNAVAILABLE;
@@ -1173,7 +1173,7 @@ Error Animation::rotation_track_get_key(int p_track, int p_key, Quaternion *r_ro
 	return OK;
 }
 
-Error Animation::try_rotation_track_interpolate(int p_track, double p_time, Quaternion *r_interpolation) const {
+Error Animation::try_rotation_track_interpolate(int p_track, double p_time, Quaternion *r_interpolation, TrackCursor *r_cursor) const {
 	ERR_FAIL_INDEX_V(p_track, tracks.size(), ERR_INVALID_PARAMETER);
 	Track *t = tracks[p_track];
 	ERR_FAIL_COND_V(t->type != TYPE_ROTATION_3D, ERR_INVALID_PARAMETER);
@@ -1181,7 +1181,7 @@ Error Animation::try_rotation_track_interpolate(int p_track, double p_time, Quat
 	RotationTrack *rt = static_cast<RotationTrack *>(t);
 
 	if (rt->compressed_track >= 0) {
-		if (_rotation_interpolate_compressed(rt->compressed_track, p_time, *r_interpolation)) {
+		if (_rotation_interpolate_compressed(rt->compressed_track, p_time, *r_interpolation, r_cursor)) {
 			return OK;
 		} else {
 			return ERR_UNAVAILABLE;
@@ -1190,7 +1190,7 @@ Error Animation::try_rotation_track_interpolate(int p_track, double p_time, Quat
 
 	bool ok = false;
 
-	Quaternion tk = _interpolate(rt->rotations, p_time, rt->interpolation, rt->loop_wrap, &ok);
+	Quaternion tk = _interpolate(rt->rotations, p_time, rt->interpolation, rt->loop_wrap, &ok, false, r_cursor);
 
 	if (!ok) {
 		return ERR_UNAVAILABLE;
@@ -1253,7 +1253,7 @@ Error Animation::scale_track_get_key(int p_track, int p_key, Vector3 *r_scale) c
 	return OK;
 }
 
-Error Animation::try_scale_track_interpolate(int p_track, double p_time, Vector3 *r_interpolation) const {
+Error Animation::try_scale_track_interpolate(int p_track, double p_time, Vector3 *r_interpolation, TrackCursor *r_cursor) const {
 	ERR_FAIL_INDEX_V(p_track, tracks.size(), ERR_INVALID_PARAMETER);
 	Track *t = tracks[p_track];
 	ERR_FAIL_COND_V(t->type != TYPE_SCALE_3D, ERR_INVALID_PARAMETER);
@@ -1261,7 +1261,7 @@ Error Animation::try_scale_track_interpolate(int p_track, double p_time, Vector3
 	ScaleTrack *st = static_cast<ScaleTrack *>(t);
 
 	if (st->compressed_track >= 0) {
-		if (_pos_scale_interpolate_compressed(st->compressed_track, p_time, *r_interpolation)) {
+		if (_pos_scale_interpolate_compressed(st->compressed_track, p_time, *r_interpolation, r_cursor)) {
 			return OK;
 		} else {
 			return ERR_UNAVAILABLE;
@@ -1270,7 +1270,7 @@ Error Animation::try_scale_track_interpolate(int p_track, double p_time, Vector3
 
 	bool ok = false;
 
-	Vector3 tk = _interpolate(st->scales, p_time, st->interpolation, st->loop_wrap, &ok);
+	Vector3 tk = _interpolate(st->scales, p_time, st->interpolation, st->loop_wrap, &ok, false, r_cursor);
 
 	if (!ok) {
 		return ERR_UNAVAILABLE;
@@ -1333,7 +1333,7 @@ Error Animation::blend_shape_track_get_key(int p_track, int p_key, float *r_blen
 	return OK;
 }
 
-Error Animation::try_blend_shape_track_interpolate(int p_track, double p_time, float *r_interpolation) const {
+Error Animation::try_blend_shape_track_interpolate(int p_track, double p_time, float *r_interpolation, TrackCursor *r_cursor) const {
 	ERR_FAIL_INDEX_V(p_track, tracks.size(), ERR_INVALID_PARAMETER);
 	Track *t = tracks[p_track];
 	ERR_FAIL_COND_V(t->type != TYPE_BLEND_SHAPE, ERR_INVALID_PARAMETER);
@@ -1341,7 +1341,7 @@ Error Animation::try_blend_shape_track_interpolate(int p_track, double p_time, f
 	BlendShapeTrack *bst = static_cast<BlendShapeTrack *>(t);
 
 	if (bst->compressed_track >= 0) {
-		if (_blend_shape_interpolate_compressed(bst->compressed_track, p_time, *r_interpolation)) {
+		if (_blend_shape_interpolate_compressed(bst->compressed_track, p_time, *r_interpolation, r_cursor)) {
 			return OK;
 		} else {
 			return ERR_UNAVAILABLE;
@@ -1350,7 +1350,7 @@ Error Animation::try_blend_shape_track_interpolate(int p_track, double p_time, f
 
 	bool ok = false;
 
-	float tk = _interpolate(bst->blend_shapes, p_time, bst->interpolation, bst->loop_wrap, &ok);
+	float tk = _interpolate(bst->blend_shapes, p_time, bst->interpolation, bst->loop_wrap, &ok, false, r_cursor);
 
 	if (!ok) {
 		return ERR_UNAVAILABLE;
@@ -2352,6 +2352,32 @@ int Animation::_find(const Vector<K> &p_keys, double p_time, bool p_backward) co
 	return middle;
 }
 
+template <class K>
+int Animation::_find_with_cursor(const Vector<K> &p_keys, double p_time, TrackCursor &r_cursor) const {
+	int len = p_keys.size();
+	if (len == 0) {
+		return -2;
+	}
+
+	// Try the key found last time and the next one first, it must give the same result as the (forward) binary search.
+	const K *keys = p_keys.ptr();
+	for (int i = MAX(r_cursor.key, -1); i <= r_cursor.key + 1 && i < len; i++) {
+		if (i >= 0 && Math::is_equal_approx(p_time, (double)keys[i].time)) {
+			r_cursor.key = i;
+			return i;
+		}
+		bool after_key = i < 0 || keys[i].time < p_time;
+		bool before_next_key = i + 1 >= len || (keys[i + 1].time > p_time && !Math::is_equal_approx(p_time, (double)keys[i + 1].time));
+		if (after_key && before_next_key) {
+			r_cursor.key = i;
+			return i;
+		}
+	}
+
+	r_cursor.key = _find(p_keys, p_time);
+	return r_cursor.key;
+}
+
 // Linear interpolation for anytype.
 
 Vector3 Animation::_interpolate(const Vector3 &p_a, const Vector3 &p_b, real_t p_c) const {
@@ -2493,8 +2519,11 @@ Variant Animation::_cubic_interpolate_angle_in_time(const Variant &p_pre_a, cons
 }
 
 template <class T>
-T Animation::_interpolate(const Vector<TKey<T>> &p_keys, double p_time, InterpolationType p_interp, bool p_loop_wrap, bool *p_ok, bool p_backward) const {
-	int len = _find(p_keys, length) + 1; // try to find last key (there may be more past the end)
+T Animation::_interpolate(const Vector<TKey<T>> &p_keys, double p_time, InterpolationType p_interp, bool p_loop_wrap, bool *p_ok, bool p_backward, TrackCursor *r_cursor) const {
+	int len = p_keys.size();
+	if (len == 0 || p_keys[len - 1].time > length) {
+		len = _find(p_keys, length) + 1; // try to find last key (there may be more past the end)
+	}
 
 	if (len <= 0) {
 		// (-1 or -2 returned originally) (plus one above)
@@ -2511,7 +2540,7 @@ T Animation::_interpolate(const Vector<TKey<T>> &p_keys, double p_time, Interpol
 		return p_keys[0].value;
 	}
 
-	int idx = _find(p_keys, p_time, p_backward);
+	int idx = (r_cursor && !p_backward) ? _find_with_cursor(p_keys, p_time, *r_cursor) : _find(p_keys, p_time, p_backward);
 
 	ERR_FAIL_COND_V(idx == -2, T());
 	int maxi = len - 1;
@@ -5069,13 +5098,13 @@ void Animation::compress(uint32_t p_page_size, uint32_t p_fps, float p_split_tol
 #endif
 }
 
-bool Animation::_rotation_interpolate_compressed(uint32_t p_compressed_track, double p_time, Quaternion &r_ret) const {
+bool Animation::_rotation_interpolate_compressed(uint32_t p_compressed_track, double p_time, Quaternion &r_ret, TrackCursor *r_cursor) const {
 	Vector3i current;
 	Vector3i next;
 	double time_current;
 	double time_next;
 
-	if (!_fetch_compressed<3>(p_compressed_track, p_time, current, time_current, next, time_next)) {
+	if (!_fetch_compressed<3>(p_compressed_track, p_time, current, time_current, next, time_next, nullptr, r_cursor)) {
 		return false; //some sort of problem
 	}
 
@@ -5093,13 +5122,13 @@ bool Animation::_rotation_interpolate_compressed(uint32_t p_compressed_track, do
 	return true;
 }
 
-bool Animation::_pos_scale_interpolate_compressed(uint32_t p_compressed_track, double p_time, Vector3 &r_ret) const {
+bool Animation::_pos_scale_interpolate_compressed(uint32_t p_compressed_track, double p_time, Vector3 &r_ret, TrackCursor *r_cursor) const {
 	Vector3i current;
 	Vector3i next;
 	double time_current;
 	double time_next;
 
-	if (!_fetch_compressed<3>(p_compressed_track, p_time, current, time_current, next, time_next)) {
+	if (!_fetch_compressed<3>(p_compressed_track, p_time, current, time_current, next, time_next, nullptr, r_cursor)) {
 		return false; //some sort of problem
 	}
 
@@ -5116,13 +5145,13 @@ bool Animation::_pos_scale_interpolate_compressed(uint32_t p_compressed_track, d
 
 	return true;
 }
-bool Animation::_blend_shape_interpolate_compressed(uint32_t p_compressed_track, double p_time, float &r_ret) const {
+bool Animation::_blend_shape_interpolate_compressed(uint32_t p_compressed_track, double p_time, float &r_ret, TrackCursor *r_cursor) const {
 	Vector3i current;
 	Vector3i next;
 	double time_current;
 	double time_next;
 
-	if (!_fetch_compressed<1>(p_compressed_track, p_time, current, time_current, next, time_next)) {
+	if (!_fetch_compressed<1>(p_compressed_track, p_time, current, time_current, next, time_next, nullptr, r_cursor)) {
 		return false; //some sort of problem
 	}
 
@@ -5141,7 +5170,7 @@ bool Animation::_blend_shape_interpolate_compressed(uint32_t p_compressed_track,
 }
 
 template <uint32_t COMPONENTS>
-bool Animation::_fetch_compressed(uint32_t p_compressed_track, double p_time, Vector3i &r_current_value, double &r_current_time, Vector3i &r_next_value, double &r_next_time, uint32_t *key_index) const {
+bool Animation::_fetch_compressed(uint32_t p_compressed_track, double p_time, Vector3i &r_current_value, double &r_current_time, Vector3i &r_next_value, double &r_next_time, uint32_t *key_index, TrackCursor *r_cursor) const {
 	ERR_FAIL_COND_V(!compression.enabled, false);
 	ERR_FAIL_UNSIGNED_INDEX_V(p_compressed_track, compression.bounds.size(), false);
 	p_time = CLAMP(p_time, 0, length);
@@ -5151,8 +5180,14 @@ bool Animation::_fetch_compressed(uint32_t p_compressed_track, double p_time, Ve
 
 	double frame_to_sec = 1.0 / double(compression.fps);
 
+	// Pages and packets are sorted by time, so scanning can start from the ones found last time if they aren't later.
+	uint32_t page_from = 0;
+	if (r_cursor && r_cursor->page < compression.pages.size() && compression.pages[r_cursor->page].time_offset <= p_time) {
+		page_from = r_cursor->page;
+	}
+
 	int32_t page_index = -1;
-	for (uint32_t i = 0; i < compression.pages.size(); i++) {
+	for (uint32_t i = page_from; i < compression.pages.size(); i++) {
 		if (compression.pages[i].time_offset > p_time) {
 			break;
 		}
@@ -5171,8 +5206,20 @@ bool Animation::_fetch_compressed(uint32_t p_compressed_track, double p_time, Ve
 	int32_t packet_idx = 0;
 	double packet_time = double(time_keys[0]) * frame_to_sec + page_base_time;
 	uint32_t base_frame = time_keys[0];
+	uint32_t packet_from = 1;
 
-	for (uint32_t i = 1; i < time_key_count; i++) {
+	if (r_cursor && !key_index && r_cursor->page == (uint32_t)page_index && r_cursor->packet > 0 && r_cursor->packet < time_key_count) {
+		uint32_t f = time_keys[r_cursor->packet * 2 + 0];
+		double frame_time = double(f) * frame_to_sec + page_base_time;
+		if (frame_time <= p_time) {
+			packet_idx = r_cursor->packet;
+			packet_time = frame_time;
+			base_frame = f;
+			packet_from = r_cursor->packet + 1;
+		}
+	}
+
+	for (uint32_t i = packet_from; i < time_key_count; i++) {
 		uint32_t f = time_keys[i * 2 + 0];
 		double frame_time = double(f) * frame_to_sec + page_base_time;
 
@@ -5189,6 +5236,11 @@ bool Animation::_fetch_compressed(uint32_t p_compressed_track, double p_time, Ve
 		base_frame = f;
 	}
 
+	if (r_cursor) {
+		r_cursor->page = page_index;
+		r_cursor->packet = packet_idx;
+	}
+
 	const uint8_t *data_keys_base = (const uint8_t *)&page_data[indices[p_compressed_track * 3 + 2]];
 
 	uint16_t time_key_data = time_keys[packet_idx * 2 + 1];
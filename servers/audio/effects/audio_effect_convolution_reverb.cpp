@@ -0,0 +1,257 @@
+/**************************************************************************/
+/*  audio_effect_convolution_reverb.cpp                                   */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#include "audio_effect_convolution_reverb.h"
+
+#include "servers/audio_server.h"
+
+void AudioEffectConvolutionReverbInstance::process(const AudioFrame *p_src_frames, AudioFrame *p_dst_frames, int p_frame_count) {
+	const float dry = base->dry;
+	const float wet = base->wet;
+
+	if (pending_filter[0]) {
+		// The impulse response changed, the new filters are ready to use.
+		for (int i = 0; i < 2; i++) {
+			retired_filter[i] = filter[i];
+			filter[i] = pending_filter[i];
+			pending_filter[i] = nullptr;
+		}
+	}
+
+	int todo = p_frame_count;
+	int offset = 0;
+
+	while (todo) {
+		int to_mix = MIN(todo, (int)INPUT_BUFFER_MAX_SIZE);
+
+		for (int j = 0; j < to_mix; j++) {
+			tmp_src[j] = p_src_frames[offset + j].l;
+		}
+
+		filter[0]->process(tmp_src, tmp_dst, to_mix);
+
+		for (int j = 0; j < to_mix; j++) {
+			p_dst_frames[offset + j].l = tmp_src[j] * dry + tmp_dst[j] * wet;
+			tmp_src[j] = p_src_frames[offset + j].r;
+		}
+
+		filter[1]->process(tmp_src, tmp_dst, to_mix);
+
+		for (int j = 0; j < to_mix; j++) {
+			p_dst_frames[offset + j].r = tmp_src[j] * dry + tmp_dst[j] * wet;
+		}
+
+		offset += to_mix;
+		todo -= to_mix;
+	}
+}
+
+AudioEffectConvolutionReverbInstance::~AudioEffectConvolutionReverbInstance() {
+	if (base.is_valid()) {
+		AudioServer::get_singleton()->lock();
+		base->instances.erase(this);
+		AudioServer::get_singleton()->unlock();
+	}
+
+	for (int i = 0; i < 2; i++) {
+		if (filter[i]) {
+			memdelete(filter[i]);
+		}
+		if (pending_filter[i]) {
+			memdelete(pending_filter[i]);
+		}
+		if (retired_filter[i]) {
+			memdelete(retired_filter[i]);
+		}
+	}
+}
+
+void AudioEffectConvolutionReverb::_update_kernel() {
+	float mix_rate = AudioServer::get_singleton()->get_mix_rate();
+	if (!kernel_dirty && kernel_mix_rate == mix_rate) {
+		return;
+	}
+
+	kernel_dirty = false;
+	kernel_mix_rate = mix_rate;
+
+	LocalVector<float> impulse[2];
+
+	if (impulse_response.is_valid()) {
+		Ref<AudioStreamPlayback> playback = impulse_response->instantiate_playback();
+		ERR_FAIL_COND_MSG(playback.is_null(), "Failed to play back the impulse response.");
+
+		// Playing back the stream resamples it to the mix rate.
+		const int max_frames = MAX_IMPULSE_RESPONSE_SEC * mix_rate;
+		AudioFrame buffer[512];
+
+		playback->start();
+		while ((int)impulse[0].size() < max_frames && playback->is_playing()) {
+			int to_mix = MIN(512, max_frames - (int)impulse[0].size());
+			int mixed = playback->mix(buffer, 1.0, to_mix);
+			for (int i = 0; i < mixed; i++) {
+				impulse[0].push_back(buffer[i].l);
+				impulse[1].push_back(buffer[i].r);
+			}
+			if (mixed < to_mix) {
+				break;
+			}
+		}
+		playback->stop();
+	}
+
+	ConvolutionFilter::Kernel new_kernel[2];
+	for (int i = 0; i < 2; i++) {
+		ConvolutionFilter::make_kernel(impulse[i].ptr(), impulse[i].size(), new_kernel[i]);
+	}
+
+	// Filters are sized for the new kernel here, so running instances don't allocate on the audio thread.
+	// Any filter of a channel fits any instance, so only enough of them are needed.
+	LocalVector<ConvolutionFilter *> new_filters[2];
+	LocalVector<ConvolutionFilter *> old_filters;
+	while (true) {
+		AudioServer::get_singleton()->lock();
+		uint32_t instance_count = instances.size();
+		if (new_filters[0].size() >= instance_count) {
+			for (int i = 0; i < 2; i++) {
+				kernel[i] = new_kernel[i];
+			}
+			kernel_version++;
+			for (AudioEffectConvolutionReverbInstance *ins : instances) {
+				for (int i = 0; i < 2; i++) {
+					if (ins->pending_filter[i]) {
+						old_filters.push_back(ins->pending_filter[i]);
+					}
+					if (ins->retired_filter[i]) {
+						old_filters.push_back(ins->retired_filter[i]);
+						ins->retired_filter[i] = nullptr;
+					}
+					ins->pending_filter[i] = new_filters[i][new_filters[i].size() - 1];
+					new_filters[i].resize(new_filters[i].size() - 1);
+				}
+			}
+			AudioServer::get_singleton()->unlock();
+			break;
+		}
+		AudioServer::get_singleton()->unlock();
+
+		while (new_filters[0].size() < instance_count) {
+			for (int i = 0; i < 2; i++) {
+				ConvolutionFilter *new_filter = memnew(ConvolutionFilter);
+				new_filter->set_kernel(new_kernel[i]);
+				new_filters[i].push_back(new_filter);
+			}
+		}
+	}
+
+	// Old kernels are released here too, rather than on the audio thread.
+	for (ConvolutionFilter *old_filter : old_filters) {
+		memdelete(old_filter);
+	}
+	for (int i = 0; i < 2; i++) {
+		for (ConvolutionFilter *new_filter : new_filters[i]) {
+			memdelete(new_filter);
+		}
+	}
+}
+
+Ref<AudioEffectInstance> AudioEffectConvolutionReverb::instantiate() {
+	_update_kernel();
+
+	Ref<AudioEffectConvolutionReverbInstance> ins;
+	ins.instantiate();
+	ins->base = Ref<AudioEffectConvolutionReverb>(this);
+
+	AudioServer::get_singleton()->lock();
+	while (true) {
+		uint32_t version = kernel_version;
+		ConvolutionFilter::Kernel current_kernel[2] = { kernel[0], kernel[1] };
+		AudioServer::get_singleton()->unlock();
+
+		for (int i = 0; i < 2; i++) {
+			if (!ins->filter[i]) {
+				ins->filter[i] = memnew(ConvolutionFilter);
+			}
+			ins->filter[i]->set_kernel(current_kernel[i]);
+		}
+
+		AudioServer::get_singleton()->lock();
+		// Otherwise the impulse response changed meanwhile, without handing filters to this instance.
+		if (version == kernel_version) {
+			instances.push_back(ins.ptr());
+			break;
+		}
+	}
+	AudioServer::get_singleton()->unlock();
+
+	return ins;
+}
+
+void AudioEffectConvolutionReverb::set_impulse_response(const Ref<AudioStream> &p_impulse_response) {
+	impulse_response = p_impulse_response;
+	kernel_dirty = true;
+	// Rendered here rather than on the audio thread, which only swaps it in.
+	_update_kernel();
+}
+
+Ref<AudioStream> AudioEffectConvolutionReverb::get_impulse_response() const {
+	return impulse_response;
+}
+
+void AudioEffectConvolutionReverb::set_dry(float p_dry) {
+	dry = p_dry;
+}
+
+float AudioEffectConvolutionReverb::get_dry() const {
+	return dry;
+}
+
+void AudioEffectConvolutionReverb::set_wet(float p_wet) {
+	wet = p_wet;
+}
+
+float AudioEffectConvolutionReverb::get_wet() const {
+	return wet;
+}
+
+void AudioEffectConvolutionReverb::_bind_methods() {
+	ClassDB::bind_method(D_METHOD("set_impulse_response", "impulse_response"), &AudioEffectConvolutionReverb::set_impulse_response);
+	ClassDB::bind_method(D_METHOD("get_impulse_response"), &AudioEffectConvolutionReverb::get_impulse_response);
+
+	ClassDB::bind_method(D_METHOD("set_dry", "amount"), &AudioEffectConvolutionReverb::set_dry);
+	ClassDB::bind_method(D_METHOD("get_dry"), &AudioEffectConvolutionReverb::get_dry);
+
+	ClassDB::bind_method(D_METHOD("set_wet", "amount"), &AudioEffectConvolutionReverb::set_wet);
+	ClassDB::bind_method(D_METHOD("get_wet"), &AudioEffectConvolutionReverb::get_wet);
+
+	ADD_PROPERTY(PropertyInfo(Variant::OBJECT, "impulse_response", PROPERTY_HINT_RESOURCE_TYPE, "AudioStream"), "set_impulse_response", "get_impulse_response");
+	ADD_PROPERTY(PropertyInfo(Variant::FLOAT, "dry", PROPERTY_HINT_RANGE, "0,1,0.01"), "set_dry", "get_dry");
+	ADD_PROPERTY(PropertyInfo(Variant::FLOAT, "wet", PROPERTY_HINT_RANGE, "0,1,0.01"), "set_wet", "get_wet");
+}
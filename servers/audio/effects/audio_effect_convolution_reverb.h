@@ -0,0 +1,110 @@
+/**************************************************************************/
+/*  audio_effect_convolution_reverb.h                                     */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#ifndef AUDIO_EFFECT_CONVOLUTION_REVERB_H
+#define AUDIO_EFFECT_CONVOLUTION_REVERB_H
+
+#include "servers/audio/audio_effect.h"
+#include "servers/audio/audio_stream.h"
+#include "servers/audio/effects/convolution_filter.h"
+
+class AudioEffectConvolutionReverb;
+
+class AudioEffectConvolutionReverbInstance : public AudioEffectInstance {
+	GDCLASS(AudioEffectConvolutionReverbInstance, AudioEffectInstance);
+
+	friend class AudioEffectConvolutionReverb;
+
+	enum {
+		INPUT_BUFFER_MAX_SIZE = 1024,
+	};
+
+	Ref<AudioEffectConvolutionReverb> base;
+
+	float tmp_src[INPUT_BUFFER_MAX_SIZE];
+	float tmp_dst[INPUT_BUFFER_MAX_SIZE];
+
+	ConvolutionFilter *filter[2] = {};
+	// Filters for a new impulse response, with their histories already sized. Set while
+	// holding the AudioServer lock, so process() only has to swap them in.
+	ConvolutionFilter *pending_filter[2] = {};
+	// Swapped out by process(), freed by the next impulse response or the instance.
+	ConvolutionFilter *retired_filter[2] = {};
+
+public:
+	virtual void process(const AudioFrame *p_src_frames, AudioFrame *p_dst_frames, int p_frame_count) override;
+
+	~AudioEffectConvolutionReverbInstance();
+};
+
+class AudioEffectConvolutionReverb : public AudioEffect {
+	GDCLASS(AudioEffectConvolutionReverb, AudioEffect);
+
+	friend class AudioEffectConvolutionReverbInstance;
+
+	enum {
+		MAX_IMPULSE_RESPONSE_SEC = 10,
+	};
+
+	Ref<AudioStream> impulse_response;
+	float dry = 1.0f;
+	float wet = 0.5f;
+
+	// Partitions of the impulse response, rendered at the mix rate they were made for.
+	// Only swapped while holding the AudioServer lock.
+	ConvolutionFilter::Kernel kernel[2];
+	uint32_t kernel_version = 0;
+	float kernel_mix_rate = 0.0f;
+	bool kernel_dirty = true;
+
+	// Running instances, only accessed while holding the AudioServer lock.
+	LocalVector<AudioEffectConvolutionReverbInstance *> instances;
+
+	void _update_kernel();
+
+protected:
+	static void _bind_methods();
+
+public:
+	void set_impulse_response(const Ref<AudioStream> &p_impulse_response);
+	Ref<AudioStream> get_impulse_response() const;
+
+	void set_dry(float p_dry);
+	float get_dry() const;
+
+	void set_wet(float p_wet);
+	float get_wet() const;
+
+	Ref<AudioEffectInstance> instantiate() override;
+
+	AudioEffectConvolutionReverb() {}
+};
+
+#endif // AUDIO_EFFECT_CONVOLUTION_REVERB_H
@@ -0,0 +1,240 @@
+/**************************************************************************/
+/*  convolution_filter.cpp                                                */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#include "convolution_filter.h"
+
+#include "core/math/math_funcs.h"
+
+ConvolutionFilter::FFT::FFT() {
+	for (int i = 0; i < SIZE / 2; i++) {
+		twiddle_real[i] = Math::cos(Math_TAU * i / SIZE);
+		twiddle_imag[i] = -Math::sin(Math_TAU * i / SIZE);
+	}
+
+	for (int i = 0; i <= SIZE; i++) {
+		split_real[i] = Math::cos(Math_PI * i / SIZE);
+		split_imag[i] = -Math::sin(Math_PI * i / SIZE);
+	}
+
+	int bits = 0;
+	while ((1 << bits) < SIZE) {
+		bits++;
+	}
+
+	for (uint32_t i = 0; i < SIZE; i++) {
+		uint32_t reversed = 0;
+		for (int j = 0; j < bits; j++) {
+			if (i & (1 << j)) {
+				reversed |= 1 << (bits - 1 - j);
+			}
+		}
+		bit_reverse[i] = reversed;
+	}
+}
+
+// In-place complex FFT of SIZE interleaved values. The inverse isn't scaled.
+void ConvolutionFilter::FFT::transform(float *p_data, bool p_inverse) const {
+	for (uint32_t i = 0; i < SIZE; i++) {
+		uint32_t j = bit_reverse[i];
+		if (i < j) {
+			SWAP(p_data[i * 2], p_data[j * 2]);
+			SWAP(p_data[i * 2 + 1], p_data[j * 2 + 1]);
+		}
+	}
+
+	const float sign = p_inverse ? -1.0f : 1.0f;
+
+	for (uint32_t size = 2; size <= SIZE; size <<= 1) {
+		uint32_t half = size >> 1;
+		uint32_t step = SIZE / size;
+
+		for (uint32_t start = 0; start < SIZE; start += size) {
+			for (uint32_t k = 0; k < half; k++) {
+				float w_real = twiddle_real[k * step];
+				float w_imag = twiddle_imag[k * step] * sign;
+				float *a = &p_data[(start + k) * 2];
+				float *b = &p_data[(start + k + half) * 2];
+
+				float t_real = b[0] * w_real - b[1] * w_imag;
+				float t_imag = b[0] * w_imag + b[1] * w_real;
+				b[0] = a[0] - t_real;
+				b[1] = a[1] - t_imag;
+				a[0] += t_real;
+				a[1] += t_imag;
+			}
+		}
+	}
+}
+
+// Transforms FFT_SIZE real values, treating even and odd values as the real and
+// imaginary parts of a half sized complex FFT, then splitting the result.
+// Writes SIZE + 1 bins and overwrites p_data.
+void ConvolutionFilter::FFT::forward_real(float *p_data, float *r_real, float *r_imag) const {
+	transform(p_data, false);
+
+	for (uint32_t k = 0; k <= SIZE; k++) {
+		uint32_t a = k % SIZE;
+		uint32_t b = (SIZE - k) % SIZE;
+
+		// Spectrum of the even values.
+		float even_real = (p_data[a * 2] + p_data[b * 2]) * 0.5f;
+		float even_imag = (p_data[a * 2 + 1] - p_data[b * 2 + 1]) * 0.5f;
+		// Spectrum of the odd values.
+		float odd_real = (p_data[a * 2 + 1] + p_data[b * 2 + 1]) * 0.5f;
+		float odd_imag = (p_data[b * 2] - p_data[a * 2]) * 0.5f;
+
+		r_real[k] = even_real + odd_real * split_real[k] - odd_imag * split_imag[k];
+		r_imag[k] = even_imag + odd_real * split_imag[k] + odd_imag * split_real[k];
+	}
+}
+
+// Inverse of forward_real(), scaled by SIZE.
+void ConvolutionFilter::FFT::inverse_real(const float *p_real, const float *p_imag, float *r_data) const {
+	for (uint32_t k = 0; k < SIZE; k++) {
+		uint32_t b = SIZE - k;
+
+		float even_real = (p_real[k] + p_real[b]) * 0.5f;
+		float even_imag = (p_imag[k] - p_imag[b]) * 0.5f;
+		float diff_real = (p_real[k] - p_real[b]) * 0.5f;
+		float diff_imag = (p_imag[k] + p_imag[b]) * 0.5f;
+
+		float odd_real = diff_real * split_real[k] + diff_imag * split_imag[k];
+		float odd_imag = diff_imag * split_real[k] - diff_real * split_imag[k];
+
+		r_data[k * 2] = even_real - odd_imag;
+		r_data[k * 2 + 1] = even_imag + odd_real;
+	}
+
+	transform(r_data, true);
+}
+
+void ConvolutionFilter::make_kernel(const float *p_impulse, int p_length, Kernel &r_kernel) {
+	r_kernel.partition_count = (MAX(p_length, 0) + PARTITION_SIZE - 1) / PARTITION_SIZE;
+	r_kernel.real.resize(r_kernel.partition_count * SPECTRUM_SIZE);
+	r_kernel.imag.resize(r_kernel.partition_count * SPECTRUM_SIZE);
+
+	FFT fft;
+	float data[FFT_SIZE];
+	// Folding the scale of the inverse FFT into the kernel saves a pass per partition.
+	const float scale = 1.0f / FFT::SIZE;
+
+	float *real = r_kernel.real.ptrw();
+	float *imag = r_kernel.imag.ptrw();
+
+	for (int p = 0; p < r_kernel.partition_count; p++) {
+		int from = p * PARTITION_SIZE;
+		int count = MIN((int)PARTITION_SIZE, p_length - from);
+
+		for (int i = 0; i < FFT_SIZE; i++) {
+			data[i] = i < count ? p_impulse[from + i] * scale : 0.0f;
+		}
+
+		fft.forward_real(data, &real[p * SPECTRUM_SIZE], &imag[p * SPECTRUM_SIZE]);
+	}
+}
+
+void ConvolutionFilter::set_kernel(const Kernel &p_kernel) {
+	kernel = p_kernel;
+	history_real.resize(kernel.partition_count * SPECTRUM_SIZE);
+	history_imag.resize(kernel.partition_count * SPECTRUM_SIZE);
+	clear();
+}
+
+void ConvolutionFilter::clear() {
+	for (int i = 0; i < FFT_SIZE; i++) {
+		input[i] = 0;
+	}
+	for (int i = 0; i < PARTITION_SIZE; i++) {
+		output[i] = 0;
+	}
+	for (uint32_t i = 0; i < history_real.size(); i++) {
+		history_real[i] = 0;
+		history_imag[i] = 0;
+	}
+	position = 0;
+	history_position = 0;
+}
+
+void ConvolutionFilter::_process_partition() {
+	memcpy(work, input, sizeof(float) * FFT_SIZE);
+	memcpy(input, input + PARTITION_SIZE, sizeof(float) * PARTITION_SIZE);
+
+	fft.forward_real(work, &history_real[history_position * SPECTRUM_SIZE], &history_imag[history_position * SPECTRUM_SIZE]);
+
+	for (int k = 0; k < SPECTRUM_SIZE; k++) {
+		accum_real[k] = 0;
+		accum_imag[k] = 0;
+	}
+
+	// Multiply each past input partition with the matching impulse response partition.
+	const float *kernel_real = kernel.real.ptr();
+	const float *kernel_imag = kernel.imag.ptr();
+	int slot = history_position;
+
+	for (int p = 0; p < kernel.partition_count; p++) {
+		const float *__restrict x_real = &history_real[slot * SPECTRUM_SIZE];
+		const float *__restrict x_imag = &history_imag[slot * SPECTRUM_SIZE];
+		const float *__restrict h_real = &kernel_real[p * SPECTRUM_SIZE];
+		const float *__restrict h_imag = &kernel_imag[p * SPECTRUM_SIZE];
+
+		for (int k = 0; k < SPECTRUM_SIZE; k++) {
+			accum_real[k] += x_real[k] * h_real[k] - x_imag[k] * h_imag[k];
+			accum_imag[k] += x_real[k] * h_imag[k] + x_imag[k] * h_real[k];
+		}
+
+		slot = slot == 0 ? kernel.partition_count - 1 : slot - 1;
+	}
+
+	// With overlap-save, only the second half of the result is free of wrap-around.
+	fft.inverse_real(accum_real, accum_imag, work);
+	memcpy(output, work + PARTITION_SIZE, sizeof(float) * PARTITION_SIZE);
+
+	history_position = (history_position + 1) % kernel.partition_count;
+}
+
+void ConvolutionFilter::process(const float *p_src, float *p_dst, int p_frames) {
+	if (kernel.partition_count == 0) {
+		for (int i = 0; i < p_frames; i++) {
+			p_dst[i] = 0;
+		}
+		return;
+	}
+
+	for (int i = 0; i < p_frames; i++) {
+		input[PARTITION_SIZE + position] = p_src[i];
+		p_dst[i] = output[position];
+
+		position++;
+		if (position == PARTITION_SIZE) {
+			_process_partition();
+			position = 0;
+		}
+	}
+}
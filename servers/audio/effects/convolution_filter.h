@@ -0,0 +1,108 @@
+/**************************************************************************/
+/*  convolution_filter.h                                                  */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#ifndef CONVOLUTION_FILTER_H
+#define CONVOLUTION_FILTER_H
+
+#include "core/templates/local_vector.h"
+#include "core/templates/vector.h"
+#include "core/typedefs.h"
+
+// Convolves a signal with an impulse response using uniformly partitioned
+// overlap-save FFT convolution. The impulse response is split into partitions
+// of PARTITION_SIZE frames, so the cost per frame grows with the number of
+// partitions instead of the number of taps, and the output is delayed by
+// PARTITION_SIZE frames.
+class ConvolutionFilter {
+public:
+	enum {
+		PARTITION_SIZE = 256,
+		FFT_SIZE = PARTITION_SIZE * 2,
+		SPECTRUM_SIZE = PARTITION_SIZE + 1, // Bins of a real FFT of FFT_SIZE frames.
+	};
+
+	// The spectra of every partition of an impulse response. Kernels only hold
+	// copy-on-write vectors, so they're cheap to share between filters.
+	struct Kernel {
+		int partition_count = 0;
+		Vector<float> real; // partition_count * SPECTRUM_SIZE values.
+		Vector<float> imag;
+	};
+
+private:
+	// Radix-2 FFT tables for FFT_SIZE real frames, computed as a complex FFT
+	// of half the size.
+	struct FFT {
+		enum {
+			SIZE = FFT_SIZE / 2,
+		};
+
+		float twiddle_real[SIZE / 2];
+		float twiddle_imag[SIZE / 2];
+		float split_real[SIZE + 1];
+		float split_imag[SIZE + 1];
+		uint32_t bit_reverse[SIZE];
+
+		void transform(float *p_data, bool p_inverse) const;
+		void forward_real(float *p_data, float *r_real, float *r_imag) const;
+		void inverse_real(const float *p_real, const float *p_imag, float *r_data) const;
+
+		FFT();
+	};
+
+	FFT fft;
+	Kernel kernel;
+
+	float input[FFT_SIZE] = {}; // Previous partition, then the one being filled.
+	float output[PARTITION_SIZE] = {};
+	int position = 0;
+
+	// Spectra of the last partition_count input partitions.
+	LocalVector<float> history_real;
+	LocalVector<float> history_imag;
+	int history_position = 0;
+
+	float accum_real[SPECTRUM_SIZE];
+	float accum_imag[SPECTRUM_SIZE];
+	float work[FFT_SIZE];
+
+	void _process_partition();
+
+public:
+	static void make_kernel(const float *p_impulse, int p_length, Kernel &r_kernel);
+
+	void set_kernel(const Kernel &p_kernel);
+	void clear();
+
+	// Writes only the convolved signal.
+	void process(const float *p_src, float *p_dst, int p_frames);
+};
+
+#endif // CONVOLUTION_FILTER_H
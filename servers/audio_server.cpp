@@ -36,6 +36,7 @@
 #include "core/io/file_access.h"
 #include "core/io/resource_loader.h"
 #include "core/math/audio_frame.h"
+#include "core/object/worker_thread_pool.h"
 #include "core/os/os.h"
 #include "core/string/string_name.h"
 #include "core/templates/pair.h"
@@ -305,7 +306,7 @@ void AudioServer::_driver_process(int p_frames, int32_t *p_buffer) {
 }
 
 void AudioServer::_mix_step() {
-	bool solo_mode = false;
+	solo_mode = false;
 
 	for (int i = 0; i < buses.size(); i++) {
 		Bus *bus = buses[i];
@@ -483,131 +484,224 @@ void AudioServer::_mix_step() {
 		}
 	}
 
-	for (int i = buses.size() - 1; i >= 0; i--) {
-		//go bus by bus
-		Bus *bus = buses[i];
+	// Resolve the sends, so every bus knows which buses it mixes in.
+	for (int i = 0; i < buses.size(); i++) {
+		buses[i]->senders.clear();
+		buses[i]->mix_depth = 0;
+	}
 
-		for (int k = 0; k < bus->channels.size(); k++) {
-			if (bus->channels[k].active && !bus->channels[k].used) {
-				//buffer was not used, but it's still active, so it must be cleaned
-				AudioFrame *buf = bus->channels.write[k].buffer.ptrw();
+	for (int i = buses.size() - 1; i > 0; i--) {
+		//everything has a send save for master bus
+		Bus *bus = buses[i];
+		Bus *send = buses[0];
 
-				for (uint32_t j = 0; j < buffer_size; j++) {
-					buf[j] = AudioFrame(0, 0);
-				}
+		if (bus_map.has(bus->send)) {
+			send = bus_map[bus->send];
+			if (send->index_cache >= bus->index_cache) { //invalid, send to master
+				send = buses[0];
 			}
 		}
 
-		//process effects
-		if (!bus->bypass) {
-			for (int j = 0; j < bus->effects.size(); j++) {
-				if (!bus->effects[j].enabled) {
-					continue;
-				}
+		send->senders.push_back(i);
+		send->mix_depth = MAX(send->mix_depth, bus->mix_depth + 1);
+	}
 
-#ifdef DEBUG_ENABLED
-				uint64_t ticks = OS::get_singleton()->get_ticks_usec();
-#endif
+	WorkerThreadPool *thread_pool = WorkerThreadPool::get_singleton();
 
-				for (int k = 0; k < bus->channels.size(); k++) {
-					if (!(bus->channels[k].active || bus->channels[k].effect_instances[j]->process_silence())) {
-						continue;
-					}
-					bus->channels.write[k].effect_instances.write[j]->process(bus->channels[k].buffer.ptr(), temp_buffer.write[k].ptrw(), buffer_size);
-				}
+	if (!threaded_bus_processing || buses.size() < 3 || thread_pool->get_thread_count() < 2) {
+		// Buses only send to buses with a lower index, so going backwards mixes every sender first.
+		for (int i = buses.size() - 1; i >= 0; i--) {
+			_mix_step_bus(i);
+		}
+	} else {
+		_release_bus_mix_batches(false);
 
-				//swap buffers, so internal buffer always has the right data
-				for (int k = 0; k < bus->channels.size(); k++) {
-					if (!(buses[i]->channels[k].active || bus->channels[k].effect_instances[j]->process_silence())) {
-						continue;
-					}
-					SWAP(bus->channels.write[k].buffer, temp_buffer.write[k]);
+		// Buses with the same mix depth never send to each other, so each depth can be mixed in parallel.
+		int max_depth = buses[0]->mix_depth;
+		bus_mix_order.clear();
+
+		for (int depth = 0; depth <= max_depth; depth++) {
+			uint32_t from = bus_mix_order.size();
+			for (int i = buses.size() - 1; i >= 0; i--) {
+				if (buses[i]->mix_depth == depth) {
+					bus_mix_order.push_back(i);
 				}
+			}
 
-#ifdef DEBUG_ENABLED
-				bus->effects.write[j].prof_time += OS::get_singleton()->get_ticks_usec() - ticks;
-#endif
+			uint32_t count = bus_mix_order.size() - from;
+			if (count == 1) {
+				_mix_step_bus(bus_mix_order[from]);
+			} else if (count > 1) {
+				BusMixBatch *batch;
+				if (free_bus_mix_batches.is_empty()) {
+					batch = memnew(BusMixBatch);
+				} else {
+					batch = free_bus_mix_batches[free_bus_mix_batches.size() - 1];
+					free_bus_mix_batches.resize(free_bus_mix_batches.size() - 1);
+				}
+				batch->buses = bus_mix_order.ptr() + from;
+				batch->count = count;
+				batch->next.set(0);
+				batch->finished.set(0);
+				batch->group_task = thread_pool->add_template_group_task(this, &AudioServer::_mix_step_bus_threaded, batch, count - 1, -1, true, SNAME("AudioServerMixBuses"));
+				bus_mix_batches.push_back(batch);
+
+				// The audio thread claims buses too, so it never waits for busy worker threads to pick up the group.
+				// It only waits for the buses workers are mixing right now, and releases the group in a later step.
+				if (!_mix_step_claimed_buses(batch)) {
+					batch->done.wait();
+				}
 			}
 		}
+	}
 
-		//process send
+	mix_frames += buffer_size;
+	to_mix = buffer_size;
+}
 
-		Bus *send = nullptr;
+void AudioServer::_mix_step_bus(int p_bus) {
+	Bus *bus = buses[p_bus];
 
-		if (i > 0) {
-			//everything has a send save for master bus
-			if (!bus_map.has(bus->send)) {
-				send = buses[0];
-			} else {
-				send = bus_map[bus->send];
-				if (send->index_cache >= bus->index_cache) { //invalid, send to master
-					send = buses[0];
-				}
+	// Mix in the sending buses, in the same order as if buses were mixed one by one.
+	for (int sender_idx : bus->senders) {
+		Bus *sender = buses[sender_idx];
+
+		for (int k = 0; k < sender->channels.size(); k++) {
+			if (!sender->channels[k].active) {
+				continue; // Silent, or went inactive during this mix.
 			}
-		}
 
-		for (int k = 0; k < bus->channels.size(); k++) {
-			if (!bus->channels[k].active) {
-				bus->channels.write[k].peak_volume = AudioFrame(AUDIO_MIN_PEAK_DB, AUDIO_MIN_PEAK_DB);
-				continue;
+			const AudioFrame *buf = sender->channels[k].buffer.ptr();
+			AudioFrame *target_buf = thread_get_channel_mix_buffer(p_bus, k);
+
+			for (uint32_t j = 0; j < buffer_size; j++) {
+				target_buf[j] += buf[j];
 			}
+		}
+	}
 
+	for (int k = 0; k < bus->channels.size(); k++) {
+		if (bus->channels[k].active && !bus->channels[k].used) {
+			//buffer was not used, but it's still active, so it must be cleaned
 			AudioFrame *buf = bus->channels.write[k].buffer.ptrw();
 
-			AudioFrame peak = AudioFrame(0, 0);
-
-			float volume = Math::db_to_linear(bus->volume_db);
+			for (uint32_t j = 0; j < buffer_size; j++) {
+				buf[j] = AudioFrame(0, 0);
+			}
+		}
+	}
 
-			if (solo_mode) {
-				if (!bus->soloed) {
-					volume = 0.0;
-				}
-			} else {
-				if (bus->mute) {
-					volume = 0.0;
-				}
+	//process effects
+	if (!bus->bypass) {
+		for (int j = 0; j < bus->effects.size(); j++) {
+			if (!bus->effects[j].enabled) {
+				continue;
 			}
 
-			//apply volume and compute peak
-			for (uint32_t j = 0; j < buffer_size; j++) {
-				buf[j] *= volume;
+#ifdef DEBUG_ENABLED
+			uint64_t ticks = OS::get_singleton()->get_ticks_usec();
+#endif
 
-				float l = ABS(buf[j].l);
-				if (l > peak.l) {
-					peak.l = l;
+			for (int k = 0; k < bus->channels.size(); k++) {
+				if (!(bus->channels[k].active || bus->channels[k].effect_instances[j]->process_silence())) {
+					continue;
 				}
-				float r = ABS(buf[j].r);
-				if (r > peak.r) {
-					peak.r = r;
+				bus->channels.write[k].effect_instances.write[j]->process(bus->channels[k].buffer.ptr(), bus->channels.write[k].effect_buffer.ptrw(), buffer_size);
+			}
+
+			//swap buffers, so internal buffer always has the right data
+			for (int k = 0; k < bus->channels.size(); k++) {
+				if (!(bus->channels[k].active || bus->channels[k].effect_instances[j]->process_silence())) {
+					continue;
 				}
+				SWAP(bus->channels.write[k].buffer, bus->channels.write[k].effect_buffer);
 			}
 
-			bus->channels.write[k].peak_volume = AudioFrame(Math::linear_to_db(peak.l + AUDIO_PEAK_OFFSET), Math::linear_to_db(peak.r + AUDIO_PEAK_OFFSET));
+#ifdef DEBUG_ENABLED
+			bus->effects.write[j].prof_time += OS::get_singleton()->get_ticks_usec() - ticks;
+#endif
+		}
+	}
+
+	for (int k = 0; k < bus->channels.size(); k++) {
+		if (!bus->channels[k].active) {
+			bus->channels.write[k].peak_volume = AudioFrame(AUDIO_MIN_PEAK_DB, AUDIO_MIN_PEAK_DB);
+			continue;
+		}
 
-			if (!bus->channels[k].used) {
-				//see if any audio is contained, because channel was not used
+		AudioFrame *buf = bus->channels.write[k].buffer.ptrw();
 
-				if (MAX(peak.r, peak.l) > Math::db_to_linear(channel_disable_threshold_db)) {
-					bus->channels.write[k].last_mix_with_audio = mix_frames;
-				} else if (mix_frames - bus->channels[k].last_mix_with_audio > channel_disable_frames) {
-					bus->channels.write[k].active = false;
-					continue; //went inactive, don't mix.
-				}
+		AudioFrame peak = AudioFrame(0, 0);
+
+		float volume = Math::db_to_linear(bus->volume_db);
+
+		if (solo_mode) {
+			if (!bus->soloed) {
+				volume = 0.0;
 			}
+		} else {
+			if (bus->mute) {
+				volume = 0.0;
+			}
+		}
 
-			if (send) {
-				//if not master bus, send
-				AudioFrame *target_buf = thread_get_channel_mix_buffer(send->index_cache, k);
+		//apply volume and compute peak
+		for (uint32_t j = 0; j < buffer_size; j++) {
+			buf[j] *= volume;
 
-				for (uint32_t j = 0; j < buffer_size; j++) {
-					target_buf[j] += buf[j];
-				}
+			float l = ABS(buf[j].l);
+			if (l > peak.l) {
+				peak.l = l;
+			}
+			float r = ABS(buf[j].r);
+			if (r > peak.r) {
+				peak.r = r;
+			}
+		}
+
+		bus->channels.write[k].peak_volume = AudioFrame(Math::linear_to_db(peak.l + AUDIO_PEAK_OFFSET), Math::linear_to_db(peak.r + AUDIO_PEAK_OFFSET));
+
+		if (!bus->channels[k].used) {
+			//see if any audio is contained, because channel was not used
+
+			if (MAX(peak.r, peak.l) > Math::db_to_linear(channel_disable_threshold_db)) {
+				bus->channels.write[k].last_mix_with_audio = mix_frames;
+			} else if (mix_frames - bus->channels[k].last_mix_with_audio > channel_disable_frames) {
+				bus->channels.write[k].active = false;
 			}
 		}
 	}
+}
 
-	mix_frames += buffer_size;
-	to_mix = buffer_size;
+// Returns whether the caller finished the last bus of the batch.
+bool AudioServer::_mix_step_claimed_buses(BusMixBatch *p_batch) {
+	bool finished_last = false;
+	uint32_t index = p_batch->next.postincrement();
+	while (index < p_batch->count) {
+		_mix_step_bus(p_batch->buses[index]);
+		finished_last = p_batch->finished.increment() == p_batch->count;
+		index = p_batch->next.postincrement();
+	}
+	return finished_last;
+}
+
+void AudioServer::_mix_step_bus_threaded(uint32_t p_index, BusMixBatch *p_batch) {
+	if (_mix_step_claimed_buses(p_batch)) {
+		p_batch->done.post();
+	}
+}
+
+void AudioServer::_release_bus_mix_batches(bool p_wait) {
+	WorkerThreadPool *thread_pool = WorkerThreadPool::get_singleton();
+	for (uint32_t i = 0; i < bus_mix_batches.size(); i++) {
+		BusMixBatch *batch = bus_mix_batches[i];
+		if (p_wait || thread_pool->is_group_task_completed(batch->group_task)) {
+			thread_pool->wait_for_group_task_completion(batch->group_task);
+			free_bus_mix_batches.push_back(batch);
+			bus_mix_batches.remove_at_unordered(i);
+			i--;
+		}
+	}
 }
 
 void AudioServer::_mix_step_for_channel(AudioFrame *p_out_buf, AudioFrame *p_source_buf, AudioFrame p_vol_start, AudioFrame p_vol_final, float p_attenuation_filter_cutoff_hz, float p_highshelf_gain, AudioFilterSW::Processor *p_processor_l, AudioFilterSW::Processor *p_processor_r) {
@@ -739,6 +833,7 @@ void AudioServer::set_bus_count(int p_count) {
 		buses.write[i]->channels.resize(channel_count);
 		for (int j = 0; j < channel_count; j++) {
 			buses.write[i]->channels.write[j].buffer.resize(buffer_size);
+			buses.write[i]->channels.write[j].effect_buffer.resize(buffer_size);
 		}
 		buses[i]->name = attempt;
 		buses[i]->solo = false;
@@ -808,6 +903,7 @@ void AudioServer::add_bus(int p_at_pos) {
 	bus->channels.resize(channel_count);
 	for (int j = 0; j < channel_count; j++) {
 		bus->channels.write[j].buffer.resize(buffer_size);
+		bus->channels.write[j].effect_buffer.resize(buffer_size);
 	}
 	bus->name = attempt;
 	bus->solo = false;
@@ -1339,17 +1435,13 @@ void AudioServer::notify_listener_changed() {
 
 void AudioServer::init_channels_and_buffers() {
 	channel_count = get_channel_count();
-	temp_buffer.resize(channel_count);
 	mix_buffer.resize(buffer_size + LOOKAHEAD_BUFFER_SIZE);
 
-	for (int i = 0; i < temp_buffer.size(); i++) {
-		temp_buffer.write[i].resize(buffer_size);
-	}
-
 	for (int i = 0; i < buses.size(); i++) {
 		buses[i]->channels.resize(channel_count);
 		for (int j = 0; j < channel_count; j++) {
 			buses.write[i]->channels.write[j].buffer.resize(buffer_size);
+			buses.write[i]->channels.write[j].effect_buffer.resize(buffer_size);
 		}
 		_update_bus_effects(i);
 	}
@@ -1358,6 +1450,7 @@ void AudioServer::init_channels_and_buffers() {
 void AudioServer::init() {
 	channel_disable_threshold_db = GLOBAL_DEF_RST("audio/buses/channel_disable_threshold_db", -60.0);
 	channel_disable_frames = float(GLOBAL_DEF_RST(PropertyInfo(Variant::FLOAT, "audio/buses/channel_disable_time", PROPERTY_HINT_RANGE, "0,5,0.01,or_greater"), 2.0)) * get_mix_rate();
+	threaded_bus_processing = GLOBAL_DEF_RST("audio/buses/threaded_bus_processing", false);
 	buffer_size = 512; //hardcoded for now
 
 	init_channels_and_buffers();
@@ -1479,6 +1572,12 @@ void AudioServer::finish() {
 		AudioDriverManager::get_driver(i)->finish();
 	}
 
+	_release_bus_mix_batches(true);
+	for (BusMixBatch *batch : free_bus_mix_batches) {
+		memdelete(batch);
+	}
+	free_bus_mix_batches.clear();
+
 	for (int i = 0; i < buses.size(); i++) {
 		memdelete(buses[i]);
 	}
@@ -1614,6 +1713,7 @@ void AudioServer::set_bus_layout(const Ref<AudioBusLayout> &p_bus_layout) {
 		buses[i]->channels.resize(channel_count);
 		for (int j = 0; j < channel_count; j++) {
 			buses.write[i]->channels.write[j].buffer.resize(buffer_size);
+			buses.write[i]->channels.write[j].effect_buffer.resize(buffer_size);
 		}
 		_update_bus_effects(i);
 	}
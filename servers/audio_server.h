@@ -33,7 +33,10 @@
 
 #include "core/math/audio_frame.h"
 #include "core/object/class_db.h"
+#include "core/object/worker_thread_pool.h"
 #include "core/os/os.h"
+#include "core/os/semaphore.h"
+#include "core/templates/local_vector.h"
 #include "core/templates/safe_list.h"
 #include "core/variant/variant.h"
 #include "servers/audio/audio_effect.h"
@@ -188,6 +191,7 @@ private:
 
 	float channel_disable_threshold_db = 0.0f;
 	uint32_t channel_disable_frames = 0;
+	bool threaded_bus_processing = false;
 
 	int channel_count = 0;
 	int to_mix = 0;
@@ -210,6 +214,7 @@ private:
 			bool active = false;
 			AudioFrame peak_volume = AudioFrame(AUDIO_MIN_PEAK_DB, AUDIO_MIN_PEAK_DB);
 			Vector<AudioFrame> buffer;
+			Vector<AudioFrame> effect_buffer; // Effects write here, then it's swapped with buffer.
 			Vector<Ref<AudioEffectInstance>> effect_instances;
 			uint64_t last_mix_with_audio = 0;
 			Channel() {}
@@ -229,6 +234,10 @@ private:
 		float volume_db = 0.0f;
 		StringName send;
 		int index_cache = 0;
+
+		// Rebuilt on every mix step.
+		LocalVector<int> senders; // Buses sending to this one, highest index first.
+		int mix_depth = 0; // Longest chain of buses sending to this one.
 	};
 
 	struct AudioStreamPlaybackBusDetails {
@@ -269,7 +278,6 @@ private:
 	// TODO document if this is necessary.
 	SafeList<AudioStreamPlaybackBusDetails *> bus_details_graveyard_frame_old;
 
-	Vector<Vector<AudioFrame>> temp_buffer; //temp_buffer for each level
 	Vector<AudioFrame> mix_buffer;
 	Vector<Bus *> buses;
 	HashMap<StringName, Bus *> bus_map;
@@ -280,7 +288,27 @@ private:
 
 	void init_channels_and_buffers();
 
+	bool solo_mode = false;
+	LocalVector<int> bus_mix_order; // Bus indices sorted by mix depth.
+
+	// Buses of one mix depth, claimed one by one by the worker threads and the audio thread.
+	// Kept until the worker pool is done with its group, which can be after the mix step ended.
+	struct BusMixBatch {
+		const int *buses = nullptr;
+		uint32_t count = 0;
+		SafeNumeric<uint32_t> next;
+		SafeNumeric<uint32_t> finished;
+		Semaphore done; // Posted when a worker thread finishes the last bus.
+		WorkerThreadPool::GroupID group_task = -1;
+	};
+	LocalVector<BusMixBatch *> bus_mix_batches; // Still used by the worker pool.
+	LocalVector<BusMixBatch *> free_bus_mix_batches;
+
 	void _mix_step();
+	void _mix_step_bus(int p_bus);
+	bool _mix_step_claimed_buses(BusMixBatch *p_batch);
+	void _mix_step_bus_threaded(uint32_t p_index, BusMixBatch *p_batch);
+	void _release_bus_mix_batches(bool p_wait);
 	void _mix_step_for_channel(AudioFrame *p_out_buf, AudioFrame *p_source_buf, AudioFrame p_vol_start, AudioFrame p_vol_final, float p_attenuation_filter_cutoff_hz, float p_highshelf_gain, AudioFilterSW::Processor *p_processor_l, AudioFilterSW::Processor *p_processor_r);
 
 	// Should only be called on the main thread.
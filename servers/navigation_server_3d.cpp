@@ -47,6 +47,8 @@ void NavigationServer3D::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("map_get_cell_height", "map"), &NavigationServer3D::map_get_cell_height);
 	ClassDB::bind_method(D_METHOD("map_set_use_edge_connections", "map", "enabled"), &NavigationServer3D::map_set_use_edge_connections);
 	ClassDB::bind_method(D_METHOD("map_get_use_edge_connections", "map"), &NavigationServer3D::map_get_use_edge_connections);
+	ClassDB::bind_method(D_METHOD("map_set_use_hierarchical_pathfinding", "map", "enabled"), &NavigationServer3D::map_set_use_hierarchical_pathfinding);
+	ClassDB::bind_method(D_METHOD("map_get_use_hierarchical_pathfinding", "map"), &NavigationServer3D::map_get_use_hierarchical_pathfinding);
 	ClassDB::bind_method(D_METHOD("map_set_edge_connection_margin", "map", "margin"), &NavigationServer3D::map_set_edge_connection_margin);
 	ClassDB::bind_method(D_METHOD("map_get_edge_connection_margin", "map"), &NavigationServer3D::map_get_edge_connection_margin);
 	ClassDB::bind_method(D_METHOD("map_set_link_connection_radius", "map", "radius"), &NavigationServer3D::map_set_link_connection_radius);
@@ -65,6 +67,7 @@ void NavigationServer3D::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("map_force_update", "map"), &NavigationServer3D::map_force_update);
 
 	ClassDB::bind_method(D_METHOD("query_path", "parameters", "result"), &NavigationServer3D::query_path);
+	ClassDB::bind_method(D_METHOD("query_paths", "parameters", "results"), &NavigationServer3D::query_paths);
 
 	ClassDB::bind_method(D_METHOD("region_create"), &NavigationServer3D::region_create);
 	ClassDB::bind_method(D_METHOD("region_set_enabled", "region", "enabled"), &NavigationServer3D::region_set_enabled);
@@ -180,6 +183,7 @@ void NavigationServer3D::_bind_methods() {
 	BIND_ENUM_CONSTANT(INFO_EDGE_MERGE_COUNT);
 	BIND_ENUM_CONSTANT(INFO_EDGE_CONNECTION_COUNT);
 	BIND_ENUM_CONSTANT(INFO_EDGE_FREE_COUNT);
+	BIND_ENUM_CONSTANT(INFO_PATH_QUERY_COUNT);
 }
 
 NavigationServer3D *NavigationServer3D::get_singleton() {
@@ -900,6 +904,49 @@ void NavigationServer3D::query_path(const Ref<NavigationPathQueryParameters3D> &
 	p_query_result->set_path_owner_ids(_query_result.path_owner_ids);
 }
 
+struct NavigationServer3DPathQueryBatch {
+	const NavigationServer3D *server = nullptr;
+	LocalVector<NavigationUtilities::PathQueryParameters> parameters;
+	LocalVector<NavigationUtilities::PathQueryResult> results;
+};
+
+static void _query_paths_thread(void *p_userdata, uint32_t p_index) {
+	NavigationServer3DPathQueryBatch *batch = static_cast<NavigationServer3DPathQueryBatch *>(p_userdata);
+	batch->results[p_index] = batch->server->_query_path(batch->parameters[p_index]);
+}
+
+void NavigationServer3D::query_paths(const TypedArray<NavigationPathQueryParameters3D> &p_query_parameters, const TypedArray<NavigationPathQueryResult3D> &p_query_results) const {
+	ERR_FAIL_COND_MSG(p_query_parameters.size() != p_query_results.size(), "The number of path query parameters and results must match.");
+
+	// Resources are only touched on the calling thread, the queries themselves only work on plain copies.
+	NavigationServer3DPathQueryBatch batch;
+	batch.server = this;
+	batch.parameters.resize(p_query_parameters.size());
+	batch.results.resize(p_query_parameters.size());
+	for (uint32_t i = 0; i < batch.parameters.size(); i++) {
+		Ref<NavigationPathQueryParameters3D> query_parameters = p_query_parameters[i];
+		ERR_FAIL_COND(query_parameters.is_null());
+		ERR_FAIL_COND(Ref<NavigationPathQueryResult3D>(p_query_results[i]).is_null());
+		batch.parameters[i] = query_parameters->get_parameters();
+	}
+
+	if (batch.parameters.size() > 1) {
+		WorkerThreadPool::GroupID group_task = WorkerThreadPool::get_singleton()->add_native_group_task(&_query_paths_thread, &batch, batch.parameters.size(), -1, true, SNAME("NavigationServer3DQueryPaths"));
+		WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group_task);
+	} else if (batch.parameters.size() == 1) {
+		_query_paths_thread(&batch, 0);
+	}
+
+	for (uint32_t i = 0; i < batch.results.size(); i++) {
+		Ref<NavigationPathQueryResult3D> query_result = p_query_results[i];
+		const NavigationUtilities::PathQueryResult &result = batch.results[i];
+		query_result->set_path(result.path);
+		query_result->set_path_types(result.path_types);
+		query_result->set_path_rids(result.path_rids);
+		query_result->set_path_owner_ids(result.path_owner_ids);
+	}
+}
+
 ///////////////////////////////////////////////////////
 
 NavigationServer3DCallback NavigationServer3DManager::create_callback = nullptr;
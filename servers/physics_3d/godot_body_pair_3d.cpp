@@ -31,6 +31,7 @@
 #include "godot_body_pair_3d.h"
 
 #include "godot_collision_solver_3d.h"
+#include "godot_collision_solver_3d_batch.h"
 #include "godot_space_3d.h"
 
 #include "core/os/os.h"
@@ -258,7 +259,7 @@ real_t combine_friction(GodotBody3D *A, GodotBody3D *B) {
 	return ABS(MIN(A->get_friction(), B->get_friction()));
 }
 
-bool GodotBodyPair3D::setup(real_t p_step) {
+bool GodotBodyPair3D::_setup_begin() {
 	check_ccd = false;
 
 	if (!A->interacts_with(B) || A->has_exception(B->get_self()) || B->has_exception(A->get_self())) {
@@ -283,19 +284,20 @@ bool GodotBodyPair3D::setup(real_t p_step) {
 
 	validate_contacts();
 
+	return true;
+}
+
+void GodotBodyPair3D::_get_shape_transforms(Transform3D &r_xform_A, Transform3D &r_xform_B) const {
 	const Vector3 &offset_A = A->get_transform().get_origin();
 	Transform3D xform_Au = Transform3D(A->get_transform().basis, Vector3());
-	Transform3D xform_A = xform_Au * A->get_shape_transform(shape_A);
+	r_xform_A = xform_Au * A->get_shape_transform(shape_A);
 
 	Transform3D xform_Bu = B->get_transform();
 	xform_Bu.origin -= offset_A;
-	Transform3D xform_B = xform_Bu * B->get_shape_transform(shape_B);
-
-	GodotShape3D *shape_A_ptr = A->get_shape(shape_A);
-	GodotShape3D *shape_B_ptr = B->get_shape(shape_B);
-
-	collided = GodotCollisionSolver3D::solve_static(shape_A_ptr, xform_A, shape_B_ptr, xform_B, _contact_added_callback, this, &sep_axis);
+	r_xform_B = xform_Bu * B->get_shape_transform(shape_B);
+}
 
+bool GodotBodyPair3D::_setup_end() {
 	if (!collided) {
 		if (A->is_continuous_collision_detection_enabled() && collide_A) {
 			check_ccd = true;
@@ -313,6 +315,46 @@ bool GodotBodyPair3D::setup(real_t p_step) {
 	return true;
 }
 
+bool GodotBodyPair3D::setup(real_t p_step) {
+	if (!_setup_begin()) {
+		return false;
+	}
+
+	Transform3D xform_A, xform_B;
+	_get_shape_transforms(xform_A, xform_B);
+
+	GodotShape3D *shape_A_ptr = A->get_shape(shape_A);
+	GodotShape3D *shape_B_ptr = B->get_shape(shape_B);
+
+	collided = GodotCollisionSolver3D::solve_static(shape_A_ptr, xform_A, shape_B_ptr, xform_B, _contact_added_callback, this, &sep_axis);
+
+	return _setup_end();
+}
+
+void GodotBodyPair3D::setup_batched(real_t p_step, GodotCollisionSolver3DBatch &p_batch) {
+	if (!_setup_begin()) {
+		return;
+	}
+
+	Transform3D xform_A, xform_B;
+	_get_shape_transforms(xform_A, xform_B);
+
+	GodotShape3D *shape_A_ptr = A->get_shape(shape_A);
+	GodotShape3D *shape_B_ptr = B->get_shape(shape_B);
+
+	if (p_batch.add_pair(shape_A_ptr, xform_A, shape_B_ptr, xform_B, this) >= 0) {
+		return; // Finished in finish_batched_setup().
+	}
+
+	collided = GodotCollisionSolver3D::solve_static(shape_A_ptr, xform_A, shape_B_ptr, xform_B, _contact_added_callback, this, &sep_axis);
+	_setup_end();
+}
+
+void GodotBodyPair3D::finish_batched_setup(const GodotCollisionSolver3DBatch &p_batch, uint32_t p_index) {
+	collided = p_batch.get_pair_result(p_index, _contact_added_callback, this);
+	_setup_end();
+}
+
 bool GodotBodyPair3D::pre_solve(real_t p_step) {
 	if (!collided) {
 		if (check_ccd) {
@@ -104,8 +104,14 @@ class GodotBodyPair3D : public GodotBodyContact3D {
 	void validate_contacts();
 	bool _test_ccd(real_t p_step, GodotBody3D *p_A, int p_shape_A, const Transform3D &p_xform_A, GodotBody3D *p_B, int p_shape_B, const Transform3D &p_xform_B);
 
+	bool _setup_begin();
+	void _get_shape_transforms(Transform3D &r_xform_A, Transform3D &r_xform_B) const;
+	bool _setup_end();
+
 public:
 	virtual bool setup(real_t p_step) override;
+	virtual void setup_batched(real_t p_step, GodotCollisionSolver3DBatch &p_batch) override;
+	virtual void finish_batched_setup(const GodotCollisionSolver3DBatch &p_batch, uint32_t p_index) override;
 	virtual bool pre_solve(real_t p_step) override;
 	virtual void solve(real_t p_step) override;
 
@@ -0,0 +1,233 @@
+/**************************************************************************/
+/*  godot_collision_solver_3d_batch.cpp                                   */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#include "godot_collision_solver_3d_batch.h"
+
+bool GodotCollisionSolver3DBatch::_get_rounded_segment(const GodotShape3D *p_shape, const Transform3D &p_transform, Vector3 &r_from, Vector3 &r_to, real_t &r_radius) {
+	// Same scaling as the analytic collisions in the SAT solver.
+	real_t scale = p_transform.basis[0].length();
+
+	switch (p_shape->get_type()) {
+		case PhysicsServer3D::SHAPE_SPHERE: {
+			const GodotSphereShape3D *sphere = static_cast<const GodotSphereShape3D *>(p_shape);
+			r_from = p_transform.origin;
+			r_to = p_transform.origin;
+			r_radius = sphere->get_radius() * scale;
+			return true;
+		}
+		case PhysicsServer3D::SHAPE_CAPSULE: {
+			const GodotCapsuleShape3D *capsule = static_cast<const GodotCapsuleShape3D *>(p_shape);
+			Vector3 capsule_axis = p_transform.basis.get_column(1) * (capsule->get_height() * 0.5 - capsule->get_radius());
+			r_from = p_transform.origin + capsule_axis;
+			r_to = p_transform.origin - capsule_axis;
+			r_radius = capsule->get_radius() * scale;
+			return true;
+		}
+		default: {
+			return false;
+		}
+	}
+}
+
+bool GodotCollisionSolver3DBatch::is_pair_supported(const GodotShape3D *p_shape_A, const GodotShape3D *p_shape_B) {
+	PhysicsServer3D::ShapeType type_A = p_shape_A->get_type();
+	PhysicsServer3D::ShapeType type_B = p_shape_B->get_type();
+	return (type_A == PhysicsServer3D::SHAPE_SPHERE || type_A == PhysicsServer3D::SHAPE_CAPSULE) &&
+			(type_B == PhysicsServer3D::SHAPE_SPHERE || type_B == PhysicsServer3D::SHAPE_CAPSULE);
+}
+
+int GodotCollisionSolver3DBatch::add_pair(const GodotShape3D *p_shape_A, const Transform3D &p_transform_A, const GodotShape3D *p_shape_B, const Transform3D &p_transform_B, GodotConstraint3D *p_constraint) {
+	if (pair_count == MAX_PAIRS || !is_pair_supported(p_shape_A, p_shape_B)) {
+		return -1;
+	}
+
+	bool swap = p_shape_A->get_type() > p_shape_B->get_type();
+	if (swap) {
+		SWAP(p_shape_A, p_shape_B);
+	}
+	const Transform3D &transform_A = swap ? p_transform_B : p_transform_A;
+	const Transform3D &transform_B = swap ? p_transform_A : p_transform_B;
+
+	Vector3 from_A, to_A, from_B, to_B;
+	real_t r_A, r_B;
+	_get_rounded_segment(p_shape_A, transform_A, from_A, to_A, r_A);
+	_get_rounded_segment(p_shape_B, transform_B, from_B, to_B, r_B);
+
+	uint32_t i = pair_count++;
+	from_a_x[i] = from_A.x;
+	from_a_y[i] = from_A.y;
+	from_a_z[i] = from_A.z;
+	to_a_x[i] = to_A.x;
+	to_a_y[i] = to_A.y;
+	to_a_z[i] = to_A.z;
+	from_b_x[i] = from_B.x;
+	from_b_y[i] = from_B.y;
+	from_b_z[i] = from_B.z;
+	to_b_x[i] = to_B.x;
+	to_b_y[i] = to_B.y;
+	to_b_z[i] = to_B.z;
+	radius_a[i] = r_A;
+	radius_b[i] = r_B;
+	swapped[i] = swap;
+	constraints[i] = p_constraint;
+
+	return i;
+}
+
+void GodotCollisionSolver3DBatch::solve() {
+	// Closest points between the segments, as Geometry3D::get_closest_points_between_segments(),
+	// followed by the sphere collision of the SAT solver's analytic_sphere_collision().
+	// Every branch is written as a select, so all lanes go through the same instructions.
+	for (uint32_t i = 0; i < pair_count; i++) {
+		real_t px = to_a_x[i] - from_a_x[i];
+		real_t py = to_a_y[i] - from_a_y[i];
+		real_t pz = to_a_z[i] - from_a_z[i];
+		real_t qx = to_b_x[i] - from_b_x[i];
+		real_t qy = to_b_y[i] - from_b_y[i];
+		real_t qz = to_b_z[i] - from_b_z[i];
+		real_t rx = from_a_x[i] - from_b_x[i];
+		real_t ry = from_a_y[i] - from_b_y[i];
+		real_t rz = from_a_z[i] - from_b_z[i];
+
+		real_t a = px * px + py * py + pz * pz;
+		real_t b = px * qx + py * qy + pz * qz;
+		real_t c = qx * qx + qy * qy + qz * qz;
+		real_t d = px * rx + py * ry + pz * rz;
+		real_t e = qx * rx + qy * ry + qz * rz;
+		real_t det = a * c - b * b;
+
+		// Segment A parameters for t = 0 and t = 1, clamped to [0, 1].
+		// The divisions are only selected when they are well defined.
+		real_t s_t0 = -d <= 0.0f ? 0.0f : (-d >= a ? 1.0f : -d / a);
+		real_t s_t1 = b - d <= 0.0f ? 0.0f : (b - d >= a ? 1.0f : (b - d) / a);
+
+		real_t s, t;
+		if (det > CMP_EPSILON) {
+			// Non parallel segments.
+			real_t bte = b * e;
+			real_t ctd = c * d;
+			real_t ate = a * e;
+			real_t btd = b * d;
+			real_t s_num = bte - ctd;
+			real_t t_num = ate - btd;
+
+			bool s_le_0 = bte <= ctd;
+			bool s_ge_1 = s_num >= det;
+			real_t t_edge = s_le_0 ? e : b + e; // Where segment B is closest to the segment A end at s = 0 or s = 1.
+
+			real_t s_edge_t0 = s_t0;
+			real_t s_edge_t1 = s_t1;
+			real_t s_edge_inside = s_le_0 ? 0.0f : 1.0f;
+
+			real_t s_edge = t_edge <= 0.0f ? s_edge_t0 : (t_edge < c ? s_edge_inside : s_edge_t1);
+			real_t t_edge_clamped = t_edge <= 0.0f ? 0.0f : (t_edge < c ? t_edge / c : 1.0f);
+
+			real_t s_inside = ate <= btd ? s_t0 : (t_num >= det ? s_t1 : s_num / det);
+			real_t t_inside = ate <= btd ? 0.0f : (t_num >= det ? 1.0f : t_num / det);
+
+			bool on_edge = s_le_0 || s_ge_1;
+			s = on_edge ? s_edge : s_inside;
+			t = on_edge ? t_edge_clamped : t_inside;
+		} else {
+			// Parallel segments.
+			s = e <= 0.0f ? s_t0 : (e >= c ? s_t1 : 0.0f);
+			t = e <= 0.0f ? 0.0f : (e >= c ? 1.0f : e / c);
+		}
+
+		real_t closest_a_x = (1 - s) * from_a_x[i] + s * to_a_x[i];
+		real_t closest_a_y = (1 - s) * from_a_y[i] + s * to_a_y[i];
+		real_t closest_a_z = (1 - s) * from_a_z[i] + s * to_a_z[i];
+		real_t closest_b_x = (1 - t) * from_b_x[i] + t * to_b_x[i];
+		real_t closest_b_y = (1 - t) * from_b_y[i] + t * to_b_y[i];
+		real_t closest_b_z = (1 - t) * from_b_z[i] + t * to_b_z[i];
+
+		real_t b_to_a_x = closest_a_x - closest_b_x;
+		real_t b_to_a_y = closest_a_y - closest_b_y;
+		real_t b_to_a_z = closest_a_z - closest_b_z;
+		real_t b_to_a_len = Math::sqrt(b_to_a_x * b_to_a_x + b_to_a_y * b_to_a_y + b_to_a_z * b_to_a_z);
+
+		real_t r_a = radius_a[i];
+		real_t r_b = radius_b[i];
+		real_t overlap = r_a + r_b - b_to_a_len;
+		collided[i] = overlap >= 0.0f;
+
+		// Spheres coincident, use arbitrary direction.
+		bool coincident = b_to_a_len < CMP_EPSILON;
+		real_t n_x = coincident ? 0.0f : b_to_a_x / b_to_a_len;
+		real_t n_y = coincident ? 1.0f : b_to_a_y / b_to_a_len;
+		real_t n_z = coincident ? 0.0f : b_to_a_z / b_to_a_len;
+
+		// Start from the smaller sphere and jump across the overlap, to keep precision with large spheres.
+		bool a_smaller = r_a < r_b;
+		real_t from_x = a_smaller ? closest_a_x - n_x * r_a : closest_b_x + n_x * r_b;
+		real_t from_y = a_smaller ? closest_a_y - n_y * r_a : closest_b_y + n_y * r_b;
+		real_t from_z = a_smaller ? closest_a_z - n_z * r_a : closest_b_z + n_z * r_b;
+		real_t jump = a_smaller ? overlap : -overlap;
+		real_t other_x = from_x + n_x * jump;
+		real_t other_y = from_y + n_y * jump;
+		real_t other_z = from_z + n_z * jump;
+
+		point_a_x[i] = a_smaller ? from_x : other_x;
+		point_a_y[i] = a_smaller ? from_y : other_y;
+		point_a_z[i] = a_smaller ? from_z : other_z;
+		point_b_x[i] = a_smaller ? other_x : from_x;
+		point_b_y[i] = a_smaller ? other_y : from_y;
+		point_b_z[i] = a_smaller ? other_z : from_z;
+		normal_x[i] = n_x;
+		normal_y[i] = n_y;
+		normal_z[i] = n_z;
+	}
+}
+
+bool GodotCollisionSolver3DBatch::get_pair_result(uint32_t p_index, GodotCollisionSolver3D::CallbackResult p_result_callback, void *p_userdata) const {
+	ERR_FAIL_UNSIGNED_INDEX_V(p_index, pair_count, false);
+
+	if (!collided[p_index]) {
+		return false;
+	}
+
+	if (p_result_callback) {
+		Vector3 point_A(point_a_x[p_index], point_a_y[p_index], point_a_z[p_index]);
+		Vector3 point_B(point_b_x[p_index], point_b_y[p_index], point_b_z[p_index]);
+		Vector3 normal(normal_x[p_index], normal_y[p_index], normal_z[p_index]);
+
+		// Same as the SAT solver's collector.
+		if (normal.dot(point_B - point_A) < 0) {
+			normal = -normal;
+		}
+		if (swapped[p_index]) {
+			p_result_callback(point_B, 0, point_A, 0, -normal, p_userdata);
+		} else {
+			p_result_callback(point_A, 0, point_B, 0, normal, p_userdata);
+		}
+	}
+
+	return true;
+}
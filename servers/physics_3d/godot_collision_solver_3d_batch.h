@@ -0,0 +1,87 @@
+/**************************************************************************/
+/*  godot_collision_solver_3d_batch.h                                     */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#ifndef GODOT_COLLISION_SOLVER_3D_BATCH_H
+#define GODOT_COLLISION_SOLVER_3D_BATCH_H
+
+#include "godot_collision_solver_3d.h"
+
+class GodotConstraint3D;
+
+// Solves many shape pairs at once, for the pairs where both shapes can be described as a segment
+// with a radius (spheres and capsules). Pairs are stored as structure of arrays and solved in one
+// branch-free loop the compiler can vectorize, instead of going through the per-pair dispatch in
+// GodotCollisionSolver3D. Results match GodotCollisionSolver3D::solve_static() without margins.
+class GodotCollisionSolver3DBatch {
+public:
+	enum {
+		MAX_PAIRS = 64
+	};
+
+private:
+	uint32_t pair_count = 0;
+
+	// Input, segments are stored with the shape of lowest type first, as the SAT solver does.
+	real_t from_a_x[MAX_PAIRS], from_a_y[MAX_PAIRS], from_a_z[MAX_PAIRS];
+	real_t to_a_x[MAX_PAIRS], to_a_y[MAX_PAIRS], to_a_z[MAX_PAIRS];
+	real_t from_b_x[MAX_PAIRS], from_b_y[MAX_PAIRS], from_b_z[MAX_PAIRS];
+	real_t to_b_x[MAX_PAIRS], to_b_y[MAX_PAIRS], to_b_z[MAX_PAIRS];
+	real_t radius_a[MAX_PAIRS];
+	real_t radius_b[MAX_PAIRS];
+	bool swapped[MAX_PAIRS];
+	GodotConstraint3D *constraints[MAX_PAIRS];
+
+	// Output.
+	real_t point_a_x[MAX_PAIRS], point_a_y[MAX_PAIRS], point_a_z[MAX_PAIRS];
+	real_t point_b_x[MAX_PAIRS], point_b_y[MAX_PAIRS], point_b_z[MAX_PAIRS];
+	real_t normal_x[MAX_PAIRS], normal_y[MAX_PAIRS], normal_z[MAX_PAIRS];
+	bool collided[MAX_PAIRS];
+
+	static bool _get_rounded_segment(const GodotShape3D *p_shape, const Transform3D &p_transform, Vector3 &r_from, Vector3 &r_to, real_t &r_radius);
+
+public:
+	static bool is_pair_supported(const GodotShape3D *p_shape_A, const GodotShape3D *p_shape_B);
+
+	// Returns the index of the pair in the batch, or -1 if the pair is not supported or the batch is full.
+	int add_pair(const GodotShape3D *p_shape_A, const Transform3D &p_transform_A, const GodotShape3D *p_shape_B, const Transform3D &p_transform_B, GodotConstraint3D *p_constraint = nullptr);
+
+	void solve();
+
+	_FORCE_INLINE_ uint32_t get_pair_count() const { return pair_count; }
+	_FORCE_INLINE_ bool is_full() const { return pair_count == MAX_PAIRS; }
+	_FORCE_INLINE_ GodotConstraint3D *get_pair_constraint(uint32_t p_index) const { return constraints[p_index]; }
+
+	// Valid after solve(). Reports the contact like solve_static() would and returns whether the pair collided.
+	bool get_pair_result(uint32_t p_index, GodotCollisionSolver3D::CallbackResult p_result_callback, void *p_userdata) const;
+
+	_FORCE_INLINE_ void clear() { pair_count = 0; }
+};
+
+#endif // GODOT_COLLISION_SOLVER_3D_BATCH_H
@@ -32,6 +32,7 @@
 #define GODOT_CONSTRAINT_3D_H
 
 class GodotBody3D;
+class GodotCollisionSolver3DBatch;
 class GodotSoftBody3D;
 
 class GodotConstraint3D {
@@ -72,6 +73,10 @@ public:
 	_FORCE_INLINE_ bool is_disabled_collisions_between_bodies() const { return disabled_collisions_between_bodies; }
 
 	virtual bool setup(real_t p_step) = 0;
+	// Constraints may queue their collision tests into the batch instead of solving them right away.
+	// In that case, finish_batched_setup() is called with the pair index once the batch is solved.
+	virtual void setup_batched(real_t p_step, GodotCollisionSolver3DBatch &p_batch) { setup(p_step); }
+	virtual void finish_batched_setup(const GodotCollisionSolver3DBatch &p_batch, uint32_t p_index) {}
 	virtual bool pre_solve(real_t p_step) = 0;
 	virtual void solve(real_t p_step) = 0;
 
@@ -30,6 +30,7 @@
 
 #include "godot_step_3d.h"
 
+#include "godot_collision_solver_3d_batch.h"
 #include "godot_joint_3d.h"
 
 #include "core/object/worker_thread_pool.h"
@@ -40,6 +41,9 @@
 #define ISLAND_COUNT_RESERVE 128
 #define ISLAND_SIZE_RESERVE 512
 #define CONSTRAINT_COUNT_RESERVE 1024
+#define CONSTRAINT_SETUP_CHUNK_SIZE 32
+
+static_assert(CONSTRAINT_SETUP_CHUNK_SIZE <= GodotCollisionSolver3DBatch::MAX_PAIRS, "A constraint setup chunk must fit in a collision batch.");
 
 void GodotStep3D::_populate_island(GodotBody3D *p_body, LocalVector<GodotBody3D *> &p_body_island, LocalVector<GodotConstraint3D *> &p_constraint_island) {
 	p_body->set_island_step(_step);
@@ -112,9 +116,22 @@ void GodotStep3D::_populate_island_soft_body(GodotSoftBody3D *p_soft_body, Local
 	}
 }
 
-void GodotStep3D::_setup_constraint(uint32_t p_constraint_index, void *p_userdata) {
-	GodotConstraint3D *constraint = all_constraints[p_constraint_index];
-	constraint->setup(delta);
+void GodotStep3D::_setup_constraints(uint32_t p_chunk_index, void *p_userdata) {
+	uint32_t from = p_chunk_index * CONSTRAINT_SETUP_CHUNK_SIZE;
+	uint32_t to = MIN(from + CONSTRAINT_SETUP_CHUNK_SIZE, all_constraints.size());
+
+	// Collision tests between simple shapes are queued, then solved together for the whole chunk.
+	GodotCollisionSolver3DBatch batch;
+	for (uint32_t constraint_index = from; constraint_index < to; ++constraint_index) {
+		all_constraints[constraint_index]->setup_batched(delta, batch);
+	}
+
+	batch.solve();
+
+	uint32_t pair_count = batch.get_pair_count();
+	for (uint32_t pair_index = 0; pair_index < pair_count; ++pair_index) {
+		batch.get_pair_constraint(pair_index)->finish_batched_setup(batch, pair_index);
+	}
 }
 
 void GodotStep3D::_pre_solve_island(LocalVector<GodotConstraint3D *> &p_constraint_island) const {
@@ -344,7 +361,8 @@ void GodotStep3D::step(GodotSpace3D *p_space, real_t p_delta) {
 	/* SETUP CONSTRAINTS / PROCESS COLLISIONS */
 
 	uint32_t total_constraint_count = all_constraints.size();
-	WorkerThreadPool::GroupID group_task = WorkerThreadPool::get_singleton()->add_template_group_task(this, &GodotStep3D::_setup_constraint, nullptr, total_constraint_count, -1, true, SNAME("Physics3DConstraintSetup"));
+	uint32_t setup_chunk_count = (total_constraint_count + CONSTRAINT_SETUP_CHUNK_SIZE - 1) / CONSTRAINT_SETUP_CHUNK_SIZE;
+	WorkerThreadPool::GroupID group_task = WorkerThreadPool::get_singleton()->add_template_group_task(this, &GodotStep3D::_setup_constraints, nullptr, setup_chunk_count, -1, true, SNAME("Physics3DConstraintSetup"));
 	WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group_task);
 
 	{ //profile
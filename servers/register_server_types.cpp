@@ -39,6 +39,7 @@
 #include "audio/effects/audio_effect_capture.h"
 #include "audio/effects/audio_effect_chorus.h"
 #include "audio/effects/audio_effect_compressor.h"
+#include "audio/effects/audio_effect_convolution_reverb.h"
 #include "audio/effects/audio_effect_delay.h"
 #include "audio/effects/audio_effect_distortion.h"
 #include "audio/effects/audio_effect_eq.h"
@@ -199,6 +200,7 @@ void register_server_types() {
 		GDREGISTER_CLASS(AudioEffectAmplify);
 
 		GDREGISTER_CLASS(AudioEffectReverb);
+		GDREGISTER_CLASS(AudioEffectConvolutionReverb);
 
 		GDREGISTER_CLASS(AudioEffectLowPassFilter);
 		GDREGISTER_CLASS(AudioEffectHighPassFilter);
@@ -316,6 +316,9 @@ RendererCanvasRender::PolygonID RendererCanvasRenderRD::request_polygon(const Ve
 		}
 		pb.index_buffer = RD::get_singleton()->index_buffer_create(p_indices.size(), RD::INDEX_BUFFER_FORMAT_UINT32, index_buffer);
 		pb.indices = RD::get_singleton()->index_array_create(pb.index_buffer, 0, p_indices.size());
+		pb.count = p_indices.size();
+	} else {
+		pb.count = p_points.size();
 	}
 
 	pb.vertex_format_id = vertex_id;
@@ -348,7 +351,141 @@ void RendererCanvasRenderRD::free_polygon(PolygonID p_polygon) {
 
 ////////////////////
 
-void RendererCanvasRenderRD::_bind_canvas_texture(RD::DrawListID p_draw_list, RID p_texture, RS::CanvasItemTextureFilter p_base_filter, RS::CanvasItemTextureRepeat p_base_repeat, RID &r_last_texture, PushConstant &push_constant, Size2 &r_texpixel_size, bool p_texture_is_data) {
+void RendererCanvasRenderRD::_record_bind_pipeline(RID p_pipeline) {
+	if (draw_batch.pipeline == p_pipeline) {
+		return;
+	}
+	DrawCommand command;
+	command.type = DrawCommand::TYPE_BIND_PIPELINE;
+	command.rid = p_pipeline;
+	draw_batch.commands.push_back(command);
+	draw_batch.pipeline = p_pipeline;
+}
+
+void RendererCanvasRenderRD::_record_bind_uniform_set(RID p_uniform_set, uint32_t p_set) {
+	if (draw_batch.uniform_sets[p_set] == p_uniform_set) {
+		return;
+	}
+	DrawCommand command;
+	command.type = DrawCommand::TYPE_BIND_UNIFORM_SET;
+	command.rid = p_uniform_set;
+	command.uniform_set = p_set;
+	draw_batch.commands.push_back(command);
+	draw_batch.uniform_sets[p_set] = p_uniform_set;
+}
+
+void RendererCanvasRenderRD::_record_bind_index_array(RID p_index_array) {
+	if (draw_batch.index_array == p_index_array) {
+		return;
+	}
+	DrawCommand command;
+	command.type = DrawCommand::TYPE_BIND_INDEX_ARRAY;
+	command.rid = p_index_array;
+	draw_batch.commands.push_back(command);
+	draw_batch.index_array = p_index_array;
+}
+
+void RendererCanvasRenderRD::_record_bind_vertex_array(RID p_vertex_array) {
+	if (draw_batch.vertex_array == p_vertex_array) {
+		return;
+	}
+	DrawCommand command;
+	command.type = DrawCommand::TYPE_BIND_VERTEX_ARRAY;
+	command.rid = p_vertex_array;
+	draw_batch.commands.push_back(command);
+	draw_batch.vertex_array = p_vertex_array;
+}
+
+void RendererCanvasRenderRD::_record_set_blend_constants(const Color &p_color) {
+	if (draw_batch.blend_constants_set && draw_batch.blend_constants == p_color) {
+		return;
+	}
+	DrawCommand command;
+	command.type = DrawCommand::TYPE_SET_BLEND_CONSTANTS;
+	command.blend_constants = p_color;
+	draw_batch.commands.push_back(command);
+	draw_batch.blend_constants_set = true;
+	draw_batch.blend_constants = p_color;
+}
+
+void RendererCanvasRenderRD::_record_scissor(bool p_enable, const Rect2 &p_rect) {
+	if (draw_batch.scissor_enabled == p_enable && (!p_enable || draw_batch.scissor_rect == p_rect)) {
+		return;
+	}
+	DrawCommand command;
+	command.type = p_enable ? DrawCommand::TYPE_ENABLE_SCISSOR : DrawCommand::TYPE_DISABLE_SCISSOR;
+	command.scissor_rect = p_rect;
+	draw_batch.commands.push_back(command);
+	draw_batch.scissor_enabled = p_enable;
+	draw_batch.scissor_rect = p_rect;
+}
+
+void RendererCanvasRenderRD::_record_draw(const InstanceData &p_instance, bool p_use_indices, uint32_t p_primitive_count, bool p_batchable, uint32_t p_instance_count) {
+	uint32_t instance_index = draw_batch.instances.size();
+	draw_batch.instances.push_back(p_instance);
+
+	if (p_batchable && draw_batch.commands.size()) {
+		// Nothing was bound since the previous draw, so this one can be drawn as its next instance.
+		DrawCommand &last = draw_batch.commands[draw_batch.commands.size() - 1];
+		if (last.type == DrawCommand::TYPE_DRAW && last.batchable && last.use_indices == p_use_indices && last.instance_index + last.instance_count == instance_index) {
+			last.instance_count++;
+			last.primitive_count += p_primitive_count;
+			return;
+		}
+	}
+
+	DrawCommand command;
+	command.type = DrawCommand::TYPE_DRAW;
+	command.use_indices = p_use_indices;
+	command.batchable = p_batchable;
+	command.instance_index = instance_index;
+	command.instance_count = p_instance_count;
+	command.primitive_count = p_primitive_count;
+	draw_batch.commands.push_back(command);
+}
+
+void RendererCanvasRenderRD::_submit_draw_batch(RD::DrawListID p_draw_list, RenderingMethod::RenderInfo *r_render_info) {
+	RenderingDevice *rd = RD::get_singleton();
+
+	PushConstant push_constant;
+	push_constant.pad[0] = 0;
+	push_constant.pad[1] = 0;
+	push_constant.pad[2] = 0;
+
+	for (const DrawCommand &command : draw_batch.commands) {
+		switch (command.type) {
+			case DrawCommand::TYPE_BIND_PIPELINE: {
+				rd->draw_list_bind_render_pipeline(p_draw_list, command.rid);
+			} break;
+			case DrawCommand::TYPE_BIND_UNIFORM_SET: {
+				rd->draw_list_bind_uniform_set(p_draw_list, command.rid, command.uniform_set);
+			} break;
+			case DrawCommand::TYPE_BIND_INDEX_ARRAY: {
+				rd->draw_list_bind_index_array(p_draw_list, command.rid);
+			} break;
+			case DrawCommand::TYPE_BIND_VERTEX_ARRAY: {
+				rd->draw_list_bind_vertex_array(p_draw_list, command.rid);
+			} break;
+			case DrawCommand::TYPE_SET_BLEND_CONSTANTS: {
+				rd->draw_list_set_blend_constants(p_draw_list, command.blend_constants);
+			} break;
+			case DrawCommand::TYPE_ENABLE_SCISSOR: {
+				rd->draw_list_enable_scissor(p_draw_list, command.scissor_rect);
+			} break;
+			case DrawCommand::TYPE_DISABLE_SCISSOR: {
+				rd->draw_list_disable_scissor(p_draw_list);
+			} break;
+			case DrawCommand::TYPE_DRAW: {
+				push_constant.base_instance_index = command.instance_index;
+				rd->draw_list_set_push_constant(p_draw_list, &push_constant, sizeof(PushConstant));
+				rd->draw_list_draw(p_draw_list, command.use_indices, command.instance_count);
+				_add_canvas_draw_info(r_render_info, command.primitive_count);
+			} break;
+		}
+	}
+}
+
+void RendererCanvasRenderRD::_bind_canvas_texture(RID p_texture, RS::CanvasItemTextureFilter p_base_filter, RS::CanvasItemTextureRepeat p_base_repeat, RID &r_last_texture, InstanceData &r_instance_data, Size2 &r_texpixel_size, bool p_texture_is_data) {
 	if (p_texture == RID()) {
 		p_texture = default_canvas_texture;
 	}
@@ -363,43 +500,43 @@ void RendererCanvasRenderRD::_bind_canvas_texture(RD::DrawListID p_draw_list, RI
 	bool use_normal;
 	bool use_specular;
 
-	bool success = RendererRD::TextureStorage::get_singleton()->canvas_texture_get_uniform_set(p_texture, p_base_filter, p_base_repeat, shader.default_version_rd_shader, CANVAS_TEXTURE_UNIFORM_SET, bool(push_constant.flags & FLAGS_CONVERT_ATTRIBUTES_TO_LINEAR), uniform_set, size, specular_shininess, use_normal, use_specular, p_texture_is_data);
+	bool success = RendererRD::TextureStorage::get_singleton()->canvas_texture_get_uniform_set(p_texture, p_base_filter, p_base_repeat, shader.default_version_rd_shader, CANVAS_TEXTURE_UNIFORM_SET, bool(r_instance_data.flags & FLAGS_CONVERT_ATTRIBUTES_TO_LINEAR), uniform_set, size, specular_shininess, use_normal, use_specular, p_texture_is_data);
 	//something odd happened
 	if (!success) {
-		_bind_canvas_texture(p_draw_list, default_canvas_texture, p_base_filter, p_base_repeat, r_last_texture, push_constant, r_texpixel_size);
+		_bind_canvas_texture(default_canvas_texture, p_base_filter, p_base_repeat, r_last_texture, r_instance_data, r_texpixel_size);
 		return;
 	}
 
-	RD::get_singleton()->draw_list_bind_uniform_set(p_draw_list, uniform_set, CANVAS_TEXTURE_UNIFORM_SET);
+	_record_bind_uniform_set(uniform_set, CANVAS_TEXTURE_UNIFORM_SET);
 
 	if (specular_shininess.a < 0.999) {
-		push_constant.flags |= FLAGS_DEFAULT_SPECULAR_MAP_USED;
+		r_instance_data.flags |= FLAGS_DEFAULT_SPECULAR_MAP_USED;
 	} else {
-		push_constant.flags &= ~FLAGS_DEFAULT_SPECULAR_MAP_USED;
+		r_instance_data.flags &= ~FLAGS_DEFAULT_SPECULAR_MAP_USED;
 	}
 
 	if (use_normal) {
-		push_constant.flags |= FLAGS_DEFAULT_NORMAL_MAP_USED;
+		r_instance_data.flags |= FLAGS_DEFAULT_NORMAL_MAP_USED;
 	} else {
-		push_constant.flags &= ~FLAGS_DEFAULT_NORMAL_MAP_USED;
+		r_instance_data.flags &= ~FLAGS_DEFAULT_NORMAL_MAP_USED;
 	}
 
-	push_constant.specular_shininess = uint32_t(CLAMP(specular_shininess.a * 255.0, 0, 255)) << 24;
-	push_constant.specular_shininess |= uint32_t(CLAMP(specular_shininess.b * 255.0, 0, 255)) << 16;
-	push_constant.specular_shininess |= uint32_t(CLAMP(specular_shininess.g * 255.0, 0, 255)) << 8;
-	push_constant.specular_shininess |= uint32_t(CLAMP(specular_shininess.r * 255.0, 0, 255));
+	r_instance_data.specular_shininess = uint32_t(CLAMP(specular_shininess.a * 255.0, 0, 255)) << 24;
+	r_instance_data.specular_shininess |= uint32_t(CLAMP(specular_shininess.b * 255.0, 0, 255)) << 16;
+	r_instance_data.specular_shininess |= uint32_t(CLAMP(specular_shininess.g * 255.0, 0, 255)) << 8;
+	r_instance_data.specular_shininess |= uint32_t(CLAMP(specular_shininess.r * 255.0, 0, 255));
 
 	r_texpixel_size.x = 1.0 / float(size.x);
 	r_texpixel_size.y = 1.0 / float(size.y);
 
-	push_constant.color_texture_pixel_size[0] = r_texpixel_size.x;
-	push_constant.color_texture_pixel_size[1] = r_texpixel_size.y;
+	r_instance_data.color_texture_pixel_size[0] = r_texpixel_size.x;
+	r_instance_data.color_texture_pixel_size[1] = r_texpixel_size.y;
 
 	r_last_texture = p_texture;
 }
 
-void RendererCanvasRenderRD::_render_item(RD::DrawListID p_draw_list, RID p_render_target, const Item *p_item, RD::FramebufferFormatID p_framebuffer_format, const Transform2D &p_canvas_transform_inverse, Item *&current_clip, Light *p_lights, PipelineVariants *p_pipeline_variants, bool &r_sdf_used) {
-	//create an empty push constant
+void RendererCanvasRenderRD::_render_item(RID p_render_target, const Item *p_item, RD::FramebufferFormatID p_framebuffer_format, const Transform2D &p_canvas_transform_inverse, Item *&current_clip, Light *p_lights, PipelineVariants *p_pipeline_variants, bool &r_sdf_used) {
+	//create an empty instance data
 	RendererRD::TextureStorage *texture_storage = RendererRD::TextureStorage::get_singleton();
 	RendererRD::MeshStorage *mesh_storage = RendererRD::MeshStorage::get_singleton();
 	RendererRD::ParticlesStorage *particles_storage = RendererRD::ParticlesStorage::get_singleton();
@@ -415,31 +552,31 @@ void RendererCanvasRenderRD::_render_item(RD::DrawListID p_draw_list, RID p_rend
 		current_repeat = p_item->texture_repeat;
 	}
 
-	PushConstant push_constant;
+	InstanceData instance_data;
 	Transform2D base_transform = p_canvas_transform_inverse * p_item->final_transform;
 	Transform2D draw_transform;
-	_update_transform_2d_to_mat2x3(base_transform, push_constant.world);
+	_update_transform_2d_to_mat2x3(base_transform, instance_data.world);
 
 	Color base_color = p_item->final_modulate;
 	bool use_linear_colors = texture_storage->render_target_is_using_hdr(p_render_target);
 
 	for (int i = 0; i < 4; i++) {
-		push_constant.modulation[i] = 0;
-		push_constant.ninepatch_margins[i] = 0;
-		push_constant.src_rect[i] = 0;
-		push_constant.dst_rect[i] = 0;
+		instance_data.modulation[i] = 0;
+		instance_data.ninepatch_margins[i] = 0;
+		instance_data.src_rect[i] = 0;
+		instance_data.dst_rect[i] = 0;
 	}
-	push_constant.flags = 0;
-	push_constant.color_texture_pixel_size[0] = 0;
-	push_constant.color_texture_pixel_size[1] = 0;
+	instance_data.flags = 0;
+	instance_data.color_texture_pixel_size[0] = 0;
+	instance_data.color_texture_pixel_size[1] = 0;
 
-	push_constant.pad[0] = 0;
-	push_constant.pad[1] = 0;
+	instance_data.pad[0] = 0;
+	instance_data.pad[1] = 0;
 
-	push_constant.lights[0] = 0;
-	push_constant.lights[1] = 0;
-	push_constant.lights[2] = 0;
-	push_constant.lights[3] = 0;
+	instance_data.lights[0] = 0;
+	instance_data.lights[1] = 0;
+	instance_data.lights[2] = 0;
+	instance_data.lights[3] = 0;
 
 	uint32_t base_flags = 0;
 	base_flags |= use_linear_colors ? FLAGS_CONVERT_ATTRIBUTES_TO_LINEAR : 0;
@@ -453,7 +590,7 @@ void RendererCanvasRenderRD::_render_item(RD::DrawListID p_draw_list, RID p_rend
 		while (light) {
 			if (light->render_index_cache >= 0 && p_item->light_mask & light->item_mask && p_item->z_final >= light->z_min && p_item->z_final <= light->z_max && p_item->global_rect_cache.intersects_transformed(light->xform_cache, light->rect_cache)) {
 				uint32_t light_index = light->render_index_cache;
-				push_constant.lights[light_count >> 2] |= light_index << ((light_count & 3) * 8);
+				instance_data.lights[light_count >> 2] |= light_index << ((light_count & 3) * 8);
 
 				light_count++;
 
@@ -476,6 +613,10 @@ void RendererCanvasRenderRD::_render_item(RD::DrawListID p_draw_list, RID p_rend
 	RID last_texture;
 	Size2 texpixel_size;
 
+	// Variant of the rect pipeline currently bound along with the quad index array, or PIPELINE_VARIANT_MAX
+	// if another command changed them. Runs of rects (text, UI) then skip rebinding for every quad.
+	PipelineVariant bound_rect_variant = PIPELINE_VARIANT_MAX;
+
 	bool skipping = false;
 
 	const Item::Command *c = p_item->commands;
@@ -485,7 +626,7 @@ void RendererCanvasRenderRD::_render_item(RD::DrawListID p_draw_list, RID p_rend
 			continue;
 		}
 
-		push_constant.flags = base_flags | (push_constant.flags & (FLAGS_DEFAULT_NORMAL_MAP_USED | FLAGS_DEFAULT_SPECULAR_MAP_USED)); // Reset on each command for safety, keep canvastexture binding config.
+		instance_data.flags = base_flags | (instance_data.flags & (FLAGS_DEFAULT_NORMAL_MAP_USED | FLAGS_DEFAULT_SPECULAR_MAP_USED)); // Reset on each command for safety, keep canvastexture binding config.
 
 		switch (c->type) {
 			case Item::Command::TYPE_RECT: {
@@ -496,18 +637,20 @@ void RendererCanvasRenderRD::_render_item(RD::DrawListID p_draw_list, RID p_rend
 				}
 
 				//bind pipeline
+				PipelineVariant rect_variant = (rect->flags & CANVAS_RECT_LCD) ? PIPELINE_VARIANT_QUAD_LCD_BLEND : PIPELINE_VARIANT_QUAD;
+				if (bound_rect_variant != rect_variant) {
+					RID pipeline = pipeline_variants->variants[light_mode][rect_variant].get_render_pipeline(RD::INVALID_ID, p_framebuffer_format);
+					_record_bind_pipeline(pipeline);
+					_record_bind_index_array(shader.quad_index_array);
+					bound_rect_variant = rect_variant;
+				}
 				if (rect->flags & CANVAS_RECT_LCD) {
-					RID pipeline = pipeline_variants->variants[light_mode][PIPELINE_VARIANT_QUAD_LCD_BLEND].get_render_pipeline(RD::INVALID_ID, p_framebuffer_format);
-					RD::get_singleton()->draw_list_bind_render_pipeline(p_draw_list, pipeline);
-					RD::get_singleton()->draw_list_set_blend_constants(p_draw_list, rect->modulate);
-				} else {
-					RID pipeline = pipeline_variants->variants[light_mode][PIPELINE_VARIANT_QUAD].get_render_pipeline(RD::INVALID_ID, p_framebuffer_format);
-					RD::get_singleton()->draw_list_bind_render_pipeline(p_draw_list, pipeline);
+					_record_set_blend_constants(rect->modulate);
 				}
 
 				//bind textures
 
-				_bind_canvas_texture(p_draw_list, rect->texture, current_filter, current_repeat, last_texture, push_constant, texpixel_size, bool(rect->flags & CANVAS_RECT_MSDF));
+				_bind_canvas_texture(rect->texture, current_filter, current_repeat, last_texture, instance_data, texpixel_size, bool(rect->flags & CANVAS_RECT_MSDF));
 
 				Rect2 src_rect;
 				Rect2 dst_rect;
@@ -527,20 +670,20 @@ void RendererCanvasRenderRD::_render_item(RD::DrawListID p_draw_list, RID p_rend
 
 					if (rect->flags & CANVAS_RECT_FLIP_H) {
 						src_rect.size.x *= -1;
-						push_constant.flags |= FLAGS_FLIP_H;
+						instance_data.flags |= FLAGS_FLIP_H;
 					}
 
 					if (rect->flags & CANVAS_RECT_FLIP_V) {
 						src_rect.size.y *= -1;
-						push_constant.flags |= FLAGS_FLIP_V;
+						instance_data.flags |= FLAGS_FLIP_V;
 					}
 
 					if (rect->flags & CANVAS_RECT_TRANSPOSE) {
-						push_constant.flags |= FLAGS_TRANSPOSE_RECT;
+						instance_data.flags |= FLAGS_TRANSPOSE_RECT;
 					}
 
 					if (rect->flags & CANVAS_RECT_CLIP_UV) {
-						push_constant.flags |= FLAGS_CLIP_RECT_UV;
+						instance_data.flags |= FLAGS_CLIP_RECT_UV;
 					}
 
 				} else {
@@ -559,13 +702,13 @@ void RendererCanvasRenderRD::_render_item(RD::DrawListID p_draw_list, RID p_rend
 				}
 
 				if (rect->flags & CANVAS_RECT_MSDF) {
-					push_constant.flags |= FLAGS_USE_MSDF;
-					push_constant.msdf[0] = rect->px_range; // Pixel range.
-					push_constant.msdf[1] = rect->outline; // Outline size.
-					push_constant.msdf[2] = 0.f; // Reserved.
-					push_constant.msdf[3] = 0.f; // Reserved.
+					instance_data.flags |= FLAGS_USE_MSDF;
+					instance_data.msdf[0] = rect->px_range; // Pixel range.
+					instance_data.msdf[1] = rect->outline; // Outline size.
+					instance_data.msdf[2] = 0.f; // Reserved.
+					instance_data.msdf[3] = 0.f; // Reserved.
 				} else if (rect->flags & CANVAS_RECT_LCD) {
-					push_constant.flags |= FLAGS_USE_LCD;
+					instance_data.flags |= FLAGS_USE_LCD;
 				}
 
 				Color modulated = rect->modulate * base_color;
@@ -573,24 +716,22 @@ void RendererCanvasRenderRD::_render_item(RD::DrawListID p_draw_list, RID p_rend
 					modulated = modulated.srgb_to_linear();
 				}
 
-				push_constant.modulation[0] = modulated.r;
-				push_constant.modulation[1] = modulated.g;
-				push_constant.modulation[2] = modulated.b;
-				push_constant.modulation[3] = modulated.a;
+				instance_data.modulation[0] = modulated.r;
+				instance_data.modulation[1] = modulated.g;
+				instance_data.modulation[2] = modulated.b;
+				instance_data.modulation[3] = modulated.a;
 
-				push_constant.src_rect[0] = src_rect.position.x;
-				push_constant.src_rect[1] = src_rect.position.y;
-				push_constant.src_rect[2] = src_rect.size.width;
-				push_constant.src_rect[3] = src_rect.size.height;
+				instance_data.src_rect[0] = src_rect.position.x;
+				instance_data.src_rect[1] = src_rect.position.y;
+				instance_data.src_rect[2] = src_rect.size.width;
+				instance_data.src_rect[3] = src_rect.size.height;
 
-				push_constant.dst_rect[0] = dst_rect.position.x;
-				push_constant.dst_rect[1] = dst_rect.position.y;
-				push_constant.dst_rect[2] = dst_rect.size.width;
-				push_constant.dst_rect[3] = dst_rect.size.height;
+				instance_data.dst_rect[0] = dst_rect.position.x;
+				instance_data.dst_rect[1] = dst_rect.position.y;
+				instance_data.dst_rect[2] = dst_rect.size.width;
+				instance_data.dst_rect[3] = dst_rect.size.height;
 
-				RD::get_singleton()->draw_list_set_push_constant(p_draw_list, &push_constant, sizeof(PushConstant));
-				RD::get_singleton()->draw_list_bind_index_array(p_draw_list, shader.quad_index_array);
-				RD::get_singleton()->draw_list_draw(p_draw_list, true);
+				_record_draw(instance_data, true, 2, true);
 
 			} break;
 
@@ -600,12 +741,13 @@ void RendererCanvasRenderRD::_render_item(RD::DrawListID p_draw_list, RID p_rend
 				//bind pipeline
 				{
 					RID pipeline = pipeline_variants->variants[light_mode][PIPELINE_VARIANT_NINEPATCH].get_render_pipeline(RD::INVALID_ID, p_framebuffer_format);
-					RD::get_singleton()->draw_list_bind_render_pipeline(p_draw_list, pipeline);
+					_record_bind_pipeline(pipeline);
+					bound_rect_variant = PIPELINE_VARIANT_MAX;
 				}
 
 				//bind textures
 
-				_bind_canvas_texture(p_draw_list, np->texture, current_filter, current_repeat, last_texture, push_constant, texpixel_size);
+				_bind_canvas_texture(np->texture, current_filter, current_repeat, last_texture, instance_data, texpixel_size);
 
 				Rect2 src_rect;
 				Rect2 dst_rect(np->rect.position.x, np->rect.position.y, np->rect.size.x, np->rect.size.y);
@@ -617,8 +759,8 @@ void RendererCanvasRenderRD::_render_item(RD::DrawListID p_draw_list, RID p_rend
 				} else {
 					if (np->source != Rect2()) {
 						src_rect = Rect2(np->source.position.x * texpixel_size.width, np->source.position.y * texpixel_size.height, np->source.size.x * texpixel_size.width, np->source.size.y * texpixel_size.height);
-						push_constant.color_texture_pixel_size[0] = 1.0 / np->source.size.width;
-						push_constant.color_texture_pixel_size[1] = 1.0 / np->source.size.height;
+						instance_data.color_texture_pixel_size[0] = 1.0 / np->source.size.width;
+						instance_data.color_texture_pixel_size[1] = 1.0 / np->source.size.height;
 
 					} else {
 						src_rect = Rect2(0, 0, 1, 1);
@@ -630,40 +772,39 @@ void RendererCanvasRenderRD::_render_item(RD::DrawListID p_draw_list, RID p_rend
 					modulated = modulated.srgb_to_linear();
 				}
 
-				push_constant.modulation[0] = modulated.r;
-				push_constant.modulation[1] = modulated.g;
-				push_constant.modulation[2] = modulated.b;
-				push_constant.modulation[3] = modulated.a;
+				instance_data.modulation[0] = modulated.r;
+				instance_data.modulation[1] = modulated.g;
+				instance_data.modulation[2] = modulated.b;
+				instance_data.modulation[3] = modulated.a;
 
-				push_constant.src_rect[0] = src_rect.position.x;
-				push_constant.src_rect[1] = src_rect.position.y;
-				push_constant.src_rect[2] = src_rect.size.width;
-				push_constant.src_rect[3] = src_rect.size.height;
+				instance_data.src_rect[0] = src_rect.position.x;
+				instance_data.src_rect[1] = src_rect.position.y;
+				instance_data.src_rect[2] = src_rect.size.width;
+				instance_data.src_rect[3] = src_rect.size.height;
 
-				push_constant.dst_rect[0] = dst_rect.position.x;
-				push_constant.dst_rect[1] = dst_rect.position.y;
-				push_constant.dst_rect[2] = dst_rect.size.width;
-				push_constant.dst_rect[3] = dst_rect.size.height;
+				instance_data.dst_rect[0] = dst_rect.position.x;
+				instance_data.dst_rect[1] = dst_rect.position.y;
+				instance_data.dst_rect[2] = dst_rect.size.width;
+				instance_data.dst_rect[3] = dst_rect.size.height;
 
-				push_constant.flags |= int(np->axis_x) << FLAGS_NINEPATCH_H_MODE_SHIFT;
-				push_constant.flags |= int(np->axis_y) << FLAGS_NINEPATCH_V_MODE_SHIFT;
+				instance_data.flags |= int(np->axis_x) << FLAGS_NINEPATCH_H_MODE_SHIFT;
+				instance_data.flags |= int(np->axis_y) << FLAGS_NINEPATCH_V_MODE_SHIFT;
 
 				if (np->draw_center) {
-					push_constant.flags |= FLAGS_NINEPACH_DRAW_CENTER;
+					instance_data.flags |= FLAGS_NINEPACH_DRAW_CENTER;
 				}
 
-				push_constant.ninepatch_margins[0] = np->margin[SIDE_LEFT];
-				push_constant.ninepatch_margins[1] = np->margin[SIDE_TOP];
-				push_constant.ninepatch_margins[2] = np->margin[SIDE_RIGHT];
-				push_constant.ninepatch_margins[3] = np->margin[SIDE_BOTTOM];
+				instance_data.ninepatch_margins[0] = np->margin[SIDE_LEFT];
+				instance_data.ninepatch_margins[1] = np->margin[SIDE_TOP];
+				instance_data.ninepatch_margins[2] = np->margin[SIDE_RIGHT];
+				instance_data.ninepatch_margins[3] = np->margin[SIDE_BOTTOM];
 
-				RD::get_singleton()->draw_list_set_push_constant(p_draw_list, &push_constant, sizeof(PushConstant));
-				RD::get_singleton()->draw_list_bind_index_array(p_draw_list, shader.quad_index_array);
-				RD::get_singleton()->draw_list_draw(p_draw_list, true);
+				_record_bind_index_array(shader.quad_index_array);
+				_record_draw(instance_data, true, 2, true);
 
 				// Restore if overridden.
-				push_constant.color_texture_pixel_size[0] = texpixel_size.x;
-				push_constant.color_texture_pixel_size[1] = texpixel_size.y;
+				instance_data.color_texture_pixel_size[0] = texpixel_size.x;
+				instance_data.color_texture_pixel_size[1] = texpixel_size.y;
 
 			} break;
 			case Item::Command::TYPE_POLYGON: {
@@ -676,7 +817,8 @@ void RendererCanvasRenderRD::_render_item(RD::DrawListID p_draw_list, RID p_rend
 					static const PipelineVariant variant[RS::PRIMITIVE_MAX] = { PIPELINE_VARIANT_ATTRIBUTE_POINTS, PIPELINE_VARIANT_ATTRIBUTE_LINES, PIPELINE_VARIANT_ATTRIBUTE_LINES_STRIP, PIPELINE_VARIANT_ATTRIBUTE_TRIANGLES, PIPELINE_VARIANT_ATTRIBUTE_TRIANGLE_STRIP };
 					ERR_CONTINUE(polygon->primitive < 0 || polygon->primitive >= RS::PRIMITIVE_MAX);
 					RID pipeline = pipeline_variants->variants[light_mode][variant[polygon->primitive]].get_render_pipeline(pb->vertex_format_id, p_framebuffer_format);
-					RD::get_singleton()->draw_list_bind_render_pipeline(p_draw_list, pipeline);
+					_record_bind_pipeline(pipeline);
+					bound_rect_variant = PIPELINE_VARIANT_MAX;
 				}
 
 				if (polygon->primitive == RS::PRIMITIVE_LINES) {
@@ -686,30 +828,29 @@ void RendererCanvasRenderRD::_render_item(RD::DrawListID p_draw_list, RID p_rend
 
 				//bind textures
 
-				_bind_canvas_texture(p_draw_list, polygon->texture, current_filter, current_repeat, last_texture, push_constant, texpixel_size);
+				_bind_canvas_texture(polygon->texture, current_filter, current_repeat, last_texture, instance_data, texpixel_size);
 
 				Color color = base_color;
 				if (use_linear_colors) {
 					color = color.srgb_to_linear();
 				}
 
-				push_constant.modulation[0] = color.r;
-				push_constant.modulation[1] = color.g;
-				push_constant.modulation[2] = color.b;
-				push_constant.modulation[3] = color.a;
+				instance_data.modulation[0] = color.r;
+				instance_data.modulation[1] = color.g;
+				instance_data.modulation[2] = color.b;
+				instance_data.modulation[3] = color.a;
 
 				for (int j = 0; j < 4; j++) {
-					push_constant.src_rect[j] = 0;
-					push_constant.dst_rect[j] = 0;
-					push_constant.ninepatch_margins[j] = 0;
+					instance_data.src_rect[j] = 0;
+					instance_data.dst_rect[j] = 0;
+					instance_data.ninepatch_margins[j] = 0;
 				}
 
-				RD::get_singleton()->draw_list_set_push_constant(p_draw_list, &push_constant, sizeof(PushConstant));
-				RD::get_singleton()->draw_list_bind_vertex_array(p_draw_list, pb->vertex_array);
+				_record_bind_vertex_array(pb->vertex_array);
 				if (pb->indices.is_valid()) {
-					RD::get_singleton()->draw_list_bind_index_array(p_draw_list, pb->indices);
+					_record_bind_index_array(pb->indices);
 				}
-				RD::get_singleton()->draw_list_draw(p_draw_list, pb->indices.is_valid());
+				_record_draw(instance_data, pb->indices.is_valid(), _indices_to_primitives(polygon->primitive, pb->count), false);
 
 			} break;
 			case Item::Command::TYPE_PRIMITIVE: {
@@ -720,47 +861,46 @@ void RendererCanvasRenderRD::_render_item(RD::DrawListID p_draw_list, RID p_rend
 					static const PipelineVariant variant[4] = { PIPELINE_VARIANT_PRIMITIVE_POINTS, PIPELINE_VARIANT_PRIMITIVE_LINES, PIPELINE_VARIANT_PRIMITIVE_TRIANGLES, PIPELINE_VARIANT_PRIMITIVE_TRIANGLES };
 					ERR_CONTINUE(primitive->point_count == 0 || primitive->point_count > 4);
 					RID pipeline = pipeline_variants->variants[light_mode][variant[primitive->point_count - 1]].get_render_pipeline(RD::INVALID_ID, p_framebuffer_format);
-					RD::get_singleton()->draw_list_bind_render_pipeline(p_draw_list, pipeline);
+					_record_bind_pipeline(pipeline);
+					bound_rect_variant = PIPELINE_VARIANT_MAX;
 				}
 
 				//bind textures
 
-				_bind_canvas_texture(p_draw_list, primitive->texture, current_filter, current_repeat, last_texture, push_constant, texpixel_size);
+				_bind_canvas_texture(primitive->texture, current_filter, current_repeat, last_texture, instance_data, texpixel_size);
 
-				RD::get_singleton()->draw_list_bind_index_array(p_draw_list, primitive_arrays.index_array[MIN(3u, primitive->point_count) - 1]);
+				_record_bind_index_array(primitive_arrays.index_array[MIN(3u, primitive->point_count) - 1]);
 
 				for (uint32_t j = 0; j < MIN(3u, primitive->point_count); j++) {
-					push_constant.points[j * 2 + 0] = primitive->points[j].x;
-					push_constant.points[j * 2 + 1] = primitive->points[j].y;
-					push_constant.uvs[j * 2 + 0] = primitive->uvs[j].x;
-					push_constant.uvs[j * 2 + 1] = primitive->uvs[j].y;
+					instance_data.points[j * 2 + 0] = primitive->points[j].x;
+					instance_data.points[j * 2 + 1] = primitive->points[j].y;
+					instance_data.uvs[j * 2 + 0] = primitive->uvs[j].x;
+					instance_data.uvs[j * 2 + 1] = primitive->uvs[j].y;
 					Color col = primitive->colors[j] * base_color;
 					if (use_linear_colors) {
 						col = col.srgb_to_linear();
 					}
-					push_constant.colors[j * 2 + 0] = (uint32_t(Math::make_half_float(col.g)) << 16) | Math::make_half_float(col.r);
-					push_constant.colors[j * 2 + 1] = (uint32_t(Math::make_half_float(col.a)) << 16) | Math::make_half_float(col.b);
+					instance_data.colors[j * 2 + 0] = (uint32_t(Math::make_half_float(col.g)) << 16) | Math::make_half_float(col.r);
+					instance_data.colors[j * 2 + 1] = (uint32_t(Math::make_half_float(col.a)) << 16) | Math::make_half_float(col.b);
 				}
-				RD::get_singleton()->draw_list_set_push_constant(p_draw_list, &push_constant, sizeof(PushConstant));
-				RD::get_singleton()->draw_list_draw(p_draw_list, true);
+				_record_draw(instance_data, true, 1, true);
 
 				if (primitive->point_count == 4) {
 					for (uint32_t j = 1; j < 3; j++) {
 						//second half of triangle
-						push_constant.points[j * 2 + 0] = primitive->points[j + 1].x;
-						push_constant.points[j * 2 + 1] = primitive->points[j + 1].y;
-						push_constant.uvs[j * 2 + 0] = primitive->uvs[j + 1].x;
-						push_constant.uvs[j * 2 + 1] = primitive->uvs[j + 1].y;
+						instance_data.points[j * 2 + 0] = primitive->points[j + 1].x;
+						instance_data.points[j * 2 + 1] = primitive->points[j + 1].y;
+						instance_data.uvs[j * 2 + 0] = primitive->uvs[j + 1].x;
+						instance_data.uvs[j * 2 + 1] = primitive->uvs[j + 1].y;
 						Color col = primitive->colors[j + 1] * base_color;
 						if (use_linear_colors) {
 							col = col.srgb_to_linear();
 						}
-						push_constant.colors[j * 2 + 0] = (uint32_t(Math::make_half_float(col.g)) << 16) | Math::make_half_float(col.r);
-						push_constant.colors[j * 2 + 1] = (uint32_t(Math::make_half_float(col.a)) << 16) | Math::make_half_float(col.b);
+						instance_data.colors[j * 2 + 0] = (uint32_t(Math::make_half_float(col.g)) << 16) | Math::make_half_float(col.r);
+						instance_data.colors[j * 2 + 1] = (uint32_t(Math::make_half_float(col.a)) << 16) | Math::make_half_float(col.b);
 					}
 
-					RD::get_singleton()->draw_list_set_push_constant(p_draw_list, &push_constant, sizeof(PushConstant));
-					RD::get_singleton()->draw_list_draw(p_draw_list, true);
+					_record_draw(instance_data, true, 1, true);
 				}
 
 			} break;
@@ -775,7 +915,7 @@ void RendererCanvasRenderRD::_render_item(RD::DrawListID p_draw_list, RID p_rend
 				int instance_count = 1;
 
 				for (int j = 0; j < 6; j++) {
-					world_backup[j] = push_constant.world[j];
+					world_backup[j] = instance_data.world[j];
 				}
 
 				if (c->type == Item::Command::TYPE_MESH) {
@@ -784,7 +924,7 @@ void RendererCanvasRenderRD::_render_item(RD::DrawListID p_draw_list, RID p_rend
 					mesh_instance = m->mesh_instance;
 					texture = m->texture;
 					modulate = m->modulate;
-					_update_transform_2d_to_mat2x3(base_transform * draw_transform * m->transform, push_constant.world);
+					_update_transform_2d_to_mat2x3(base_transform * draw_transform * m->transform, instance_data.world);
 				} else if (c->type == Item::Command::TYPE_MULTIMESH) {
 					const Item::CommandMultiMesh *mm = static_cast<const Item::CommandMultiMesh *>(c);
 					RID multimesh = mm->multimesh;
@@ -802,13 +942,13 @@ void RendererCanvasRenderRD::_render_item(RD::DrawListID p_draw_list, RID p_rend
 					}
 
 					RID uniform_set = mesh_storage->multimesh_get_2d_uniform_set(multimesh, shader.default_version_rd_shader, TRANSFORMS_UNIFORM_SET);
-					RD::get_singleton()->draw_list_bind_uniform_set(p_draw_list, uniform_set, TRANSFORMS_UNIFORM_SET);
-					push_constant.flags |= 1; //multimesh, trails disabled
+					_record_bind_uniform_set(uniform_set, TRANSFORMS_UNIFORM_SET);
+					instance_data.flags |= 1; //multimesh, trails disabled
 					if (mesh_storage->multimesh_uses_colors(multimesh)) {
-						push_constant.flags |= FLAGS_INSTANCING_HAS_COLORS;
+						instance_data.flags |= FLAGS_INSTANCING_HAS_COLORS;
 					}
 					if (mesh_storage->multimesh_uses_custom_data(multimesh)) {
-						push_constant.flags |= FLAGS_INSTANCING_HAS_CUSTOM_DATA;
+						instance_data.flags |= FLAGS_INSTANCING_HAS_CUSTOM_DATA;
 					}
 				} else if (c->type == Item::Command::TYPE_PARTICLES) {
 					const Item::CommandParticles *pt = static_cast<const Item::CommandParticles *>(c);
@@ -829,13 +969,13 @@ void RendererCanvasRenderRD::_render_item(RD::DrawListID p_draw_list, RID p_rend
 					instance_count = particles_storage->particles_get_amount(pt->particles, divisor);
 
 					RID uniform_set = particles_storage->particles_get_instance_buffer_uniform_set(pt->particles, shader.default_version_rd_shader, TRANSFORMS_UNIFORM_SET);
-					RD::get_singleton()->draw_list_bind_uniform_set(p_draw_list, uniform_set, TRANSFORMS_UNIFORM_SET);
+					_record_bind_uniform_set(uniform_set, TRANSFORMS_UNIFORM_SET);
 
-					push_constant.flags |= divisor;
+					instance_data.flags |= divisor;
 					instance_count /= divisor;
 
-					push_constant.flags |= FLAGS_INSTANCING_HAS_COLORS;
-					push_constant.flags |= FLAGS_INSTANCING_HAS_CUSTOM_DATA;
+					instance_data.flags |= FLAGS_INSTANCING_HAS_COLORS;
+					instance_data.flags |= FLAGS_INSTANCING_HAS_CUSTOM_DATA;
 
 					mesh = particles_storage->particles_get_draw_pass_mesh(pt->particles, 0); //higher ones are ignored
 					texture = pt->texture;
@@ -867,7 +1007,7 @@ void RendererCanvasRenderRD::_render_item(RD::DrawListID p_draw_list, RID p_rend
 					break;
 				}
 
-				_bind_canvas_texture(p_draw_list, texture, current_filter, current_repeat, last_texture, push_constant, texpixel_size);
+				_bind_canvas_texture(texture, current_filter, current_repeat, last_texture, instance_data, texpixel_size);
 
 				uint32_t surf_count = mesh_storage->mesh_get_surface_count(mesh);
 				static const PipelineVariant variant[RS::PRIMITIVE_MAX] = { PIPELINE_VARIANT_ATTRIBUTE_POINTS, PIPELINE_VARIANT_ATTRIBUTE_LINES, PIPELINE_VARIANT_ATTRIBUTE_LINES_STRIP, PIPELINE_VARIANT_ATTRIBUTE_TRIANGLES, PIPELINE_VARIANT_ATTRIBUTE_TRIANGLE_STRIP };
@@ -877,15 +1017,15 @@ void RendererCanvasRenderRD::_render_item(RD::DrawListID p_draw_list, RID p_rend
 					modulated = modulated.srgb_to_linear();
 				}
 
-				push_constant.modulation[0] = modulated.r;
-				push_constant.modulation[1] = modulated.g;
-				push_constant.modulation[2] = modulated.b;
-				push_constant.modulation[3] = modulated.a;
+				instance_data.modulation[0] = modulated.r;
+				instance_data.modulation[1] = modulated.g;
+				instance_data.modulation[2] = modulated.b;
+				instance_data.modulation[3] = modulated.a;
 
 				for (int j = 0; j < 4; j++) {
-					push_constant.src_rect[j] = 0;
-					push_constant.dst_rect[j] = 0;
-					push_constant.ninepatch_margins[j] = 0;
+					instance_data.src_rect[j] = 0;
+					instance_data.dst_rect[j] = 0;
+					instance_data.ninepatch_margins[j] = 0;
 				}
 
 				for (uint32_t j = 0; j < surf_count; j++) {
@@ -906,28 +1046,27 @@ void RendererCanvasRenderRD::_render_item(RD::DrawListID p_draw_list, RID p_rend
 					}
 
 					RID pipeline = pipeline_variants->variants[light_mode][variant[primitive]].get_render_pipeline(vertex_format, p_framebuffer_format);
-					RD::get_singleton()->draw_list_bind_render_pipeline(p_draw_list, pipeline);
+					_record_bind_pipeline(pipeline);
+					bound_rect_variant = PIPELINE_VARIANT_MAX;
 
 					RID index_array = mesh_storage->mesh_surface_get_index_array(surface, 0);
 
 					if (index_array.is_valid()) {
-						RD::get_singleton()->draw_list_bind_index_array(p_draw_list, index_array);
+						_record_bind_index_array(index_array);
 					}
 
-					RD::get_singleton()->draw_list_bind_vertex_array(p_draw_list, vertex_array);
-					RD::get_singleton()->draw_list_set_push_constant(p_draw_list, &push_constant, sizeof(PushConstant));
-
-					RD::get_singleton()->draw_list_draw(p_draw_list, index_array.is_valid(), instance_count);
+					_record_bind_vertex_array(vertex_array);
+					_record_draw(instance_data, index_array.is_valid(), _indices_to_primitives(primitive, mesh_storage->mesh_surface_get_vertices_drawn_count(surface)) * instance_count, false, instance_count);
 				}
 
 				for (int j = 0; j < 6; j++) {
-					push_constant.world[j] = world_backup[j];
+					instance_data.world[j] = world_backup[j];
 				}
 			} break;
 			case Item::Command::TYPE_TRANSFORM: {
 				const Item::CommandTransform *transform = static_cast<const Item::CommandTransform *>(c);
 				draw_transform = transform->xform;
-				_update_transform_2d_to_mat2x3(base_transform * transform->xform, push_constant.world);
+				_update_transform_2d_to_mat2x3(base_transform * transform->xform, instance_data.world);
 
 			} break;
 			case Item::Command::TYPE_CLIP_IGNORE: {
@@ -935,10 +1074,10 @@ void RendererCanvasRenderRD::_render_item(RD::DrawListID p_draw_list, RID p_rend
 				if (current_clip) {
 					if (ci->ignore != reclip) {
 						if (ci->ignore) {
-							RD::get_singleton()->draw_list_disable_scissor(p_draw_list);
+							_record_scissor(false);
 							reclip = true;
 						} else {
-							RD::get_singleton()->draw_list_enable_scissor(p_draw_list, current_clip->final_clip_rect);
+							_record_scissor(true, current_clip->final_clip_rect);
 							reclip = false;
 						}
 					}
@@ -963,11 +1102,11 @@ void RendererCanvasRenderRD::_render_item(RD::DrawListID p_draw_list, RID p_rend
 		dc.a *= p_item->debug_redraw_time / debug_redraw_time;
 
 		RID pipeline = pipeline_variants->variants[PIPELINE_LIGHT_MODE_DISABLED][PIPELINE_VARIANT_QUAD].get_render_pipeline(RD::INVALID_ID, p_framebuffer_format);
-		RD::get_singleton()->draw_list_bind_render_pipeline(p_draw_list, pipeline);
+		_record_bind_pipeline(pipeline);
 
 		//bind textures
 
-		_bind_canvas_texture(p_draw_list, RID(), current_filter, current_repeat, last_texture, push_constant, texpixel_size);
+		_bind_canvas_texture(RID(), current_filter, current_repeat, last_texture, instance_data, texpixel_size);
 
 		Rect2 src_rect;
 		Rect2 dst_rect;
@@ -975,24 +1114,23 @@ void RendererCanvasRenderRD::_render_item(RD::DrawListID p_draw_list, RID p_rend
 		dst_rect = Rect2(Vector2(), p_item->rect.size);
 		src_rect = Rect2(0, 0, 1, 1);
 
-		push_constant.modulation[0] = dc.r;
-		push_constant.modulation[1] = dc.g;
-		push_constant.modulation[2] = dc.b;
-		push_constant.modulation[3] = dc.a;
+		instance_data.modulation[0] = dc.r;
+		instance_data.modulation[1] = dc.g;
+		instance_data.modulation[2] = dc.b;
+		instance_data.modulation[3] = dc.a;
 
-		push_constant.src_rect[0] = src_rect.position.x;
-		push_constant.src_rect[1] = src_rect.position.y;
-		push_constant.src_rect[2] = src_rect.size.width;
-		push_constant.src_rect[3] = src_rect.size.height;
+		instance_data.src_rect[0] = src_rect.position.x;
+		instance_data.src_rect[1] = src_rect.position.y;
+		instance_data.src_rect[2] = src_rect.size.width;
+		instance_data.src_rect[3] = src_rect.size.height;
 
-		push_constant.dst_rect[0] = dst_rect.position.x;
-		push_constant.dst_rect[1] = dst_rect.position.y;
-		push_constant.dst_rect[2] = dst_rect.size.width;
-		push_constant.dst_rect[3] = dst_rect.size.height;
+		instance_data.dst_rect[0] = dst_rect.position.x;
+		instance_data.dst_rect[1] = dst_rect.position.y;
+		instance_data.dst_rect[2] = dst_rect.size.width;
+		instance_data.dst_rect[3] = dst_rect.size.height;
 
-		RD::get_singleton()->draw_list_set_push_constant(p_draw_list, &push_constant, sizeof(PushConstant));
-		RD::get_singleton()->draw_list_bind_index_array(p_draw_list, shader.quad_index_array);
-		RD::get_singleton()->draw_list_draw(p_draw_list, true);
+		_record_bind_index_array(shader.quad_index_array);
+		_record_draw(instance_data, true, 2, true);
 
 		p_item->debug_redraw_time -= RSG::rasterizer->get_frame_delta_time();
 
@@ -1078,6 +1216,14 @@ RID RendererCanvasRenderRD::_create_base_uniform_set(RID p_to_render_target, boo
 		uniforms.push_back(u);
 	}
 
+	{
+		RD::Uniform u;
+		u.uniform_type = RD::UNIFORM_TYPE_STORAGE_BUFFER;
+		u.binding = 8;
+		u.append_id(state.instance_buffer);
+		uniforms.push_back(u);
+	}
+
 	{
 		RD::Uniform u;
 		u.uniform_type = RD::UNIFORM_TYPE_STORAGE_BUFFER;
@@ -1098,7 +1244,7 @@ RID RendererCanvasRenderRD::_create_base_uniform_set(RID p_to_render_target, boo
 	return uniform_set;
 }
 
-void RendererCanvasRenderRD::_render_items(RID p_to_render_target, int p_item_count, const Transform2D &p_canvas_transform_inverse, Light *p_lights, bool &r_sdf_used, bool p_to_backbuffer) {
+void RendererCanvasRenderRD::_render_items(RID p_to_render_target, int p_item_count, const Transform2D &p_canvas_transform_inverse, Light *p_lights, bool &r_sdf_used, bool p_to_backbuffer, RenderingMethod::RenderInfo *r_render_info) {
 	RendererRD::MaterialStorage *material_storage = RendererRD::MaterialStorage::get_singleton();
 	RendererRD::TextureStorage *texture_storage = RendererRD::TextureStorage::get_singleton();
 
@@ -1127,16 +1273,19 @@ void RendererCanvasRenderRD::_render_items(RID p_to_render_target, int p_item_co
 		fb_uniform_set = texture_storage->render_target_get_framebuffer_uniform_set(p_to_render_target);
 	}
 
-	if (fb_uniform_set.is_null() || !RD::get_singleton()->uniform_set_is_valid(fb_uniform_set)) {
-		fb_uniform_set = _create_base_uniform_set(p_to_render_target, p_to_backbuffer);
-	}
-
 	RD::FramebufferFormatID fb_format = RD::get_singleton()->framebuffer_get_format(framebuffer);
 
-	RD::DrawListID draw_list = RD::get_singleton()->draw_list_begin(framebuffer, clear ? RD::INITIAL_ACTION_CLEAR : RD::INITIAL_ACTION_KEEP, RD::FINAL_ACTION_READ, RD::INITIAL_ACTION_KEEP, RD::FINAL_ACTION_DISCARD, clear_colors);
-
-	RD::get_singleton()->draw_list_bind_uniform_set(draw_list, fb_uniform_set, BASE_UNIFORM_SET);
-	RD::get_singleton()->draw_list_bind_uniform_set(draw_list, state.default_transforms_uniform_set, TRANSFORMS_UNIFORM_SET);
+	draw_batch.commands.clear();
+	draw_batch.instances.clear();
+	draw_batch.pipeline = RID();
+	for (uint32_t i = 0; i <= CANVAS_TEXTURE_UNIFORM_SET; i++) {
+		draw_batch.uniform_sets[i] = RID();
+	}
+	draw_batch.uniform_sets[TRANSFORMS_UNIFORM_SET] = state.default_transforms_uniform_set; // Bound when the draw list begins.
+	draw_batch.index_array = RID();
+	draw_batch.vertex_array = RID();
+	draw_batch.blend_constants_set = false;
+	draw_batch.scissor_enabled = false;
 
 	RID prev_material;
 
@@ -1150,10 +1299,10 @@ void RendererCanvasRenderRD::_render_items(RID p_to_render_target, int p_item_co
 
 			//setup clip
 			if (current_clip) {
-				RD::get_singleton()->draw_list_enable_scissor(draw_list, current_clip->final_clip_rect);
+				_record_scissor(true, current_clip->final_clip_rect);
 
 			} else {
-				RD::get_singleton()->draw_list_disable_scissor(draw_list);
+				_record_scissor(false);
 			}
 		}
 
@@ -1185,7 +1334,7 @@ void RendererCanvasRenderRD::_render_items(RID p_to_render_target, int p_item_co
 					// Update uniform set.
 					RID uniform_set = texture_storage->render_target_is_using_hdr(p_to_render_target) ? material_data->uniform_set : material_data->uniform_set_srgb;
 					if (uniform_set.is_valid() && RD::get_singleton()->uniform_set_is_valid(uniform_set)) { // Material may not have a uniform set.
-						RD::get_singleton()->draw_list_bind_uniform_set(draw_list, uniform_set, MATERIAL_UNIFORM_SET);
+						_record_bind_uniform_set(uniform_set, MATERIAL_UNIFORM_SET);
 						material_data->set_as_used();
 					}
 				} else {
@@ -1196,15 +1345,41 @@ void RendererCanvasRenderRD::_render_items(RID p_to_render_target, int p_item_co
 			}
 		}
 
-		_render_item(draw_list, p_to_render_target, ci, fb_format, canvas_transform_inverse, current_clip, p_lights, pipeline_variants, r_sdf_used);
+		_render_item(p_to_render_target, ci, fb_format, canvas_transform_inverse, current_clip, p_lights, pipeline_variants, r_sdf_used);
+
+		if (r_render_info) {
+			r_render_info->info[RS::VIEWPORT_RENDER_INFO_TYPE_CANVAS][RS::VIEWPORT_RENDER_INFO_OBJECTS_IN_FRAME]++;
+		}
 
 		prev_material = material;
 	}
 
+	if (draw_batch.instances.size() > state.instance_buffer_capacity) {
+		// Freeing the buffer also frees the base uniform sets using it, they are created again below.
+		RD::get_singleton()->free(state.instance_buffer);
+		state.instance_buffer_capacity = next_power_of_2(draw_batch.instances.size());
+		state.instance_buffer = RD::get_singleton()->storage_buffer_create(sizeof(InstanceData) * state.instance_buffer_capacity);
+	}
+
+	if (draw_batch.instances.size()) {
+		RD::get_singleton()->buffer_update(state.instance_buffer, 0, sizeof(InstanceData) * draw_batch.instances.size(), draw_batch.instances.ptr());
+	}
+
+	if (fb_uniform_set.is_null() || !RD::get_singleton()->uniform_set_is_valid(fb_uniform_set)) {
+		fb_uniform_set = _create_base_uniform_set(p_to_render_target, p_to_backbuffer);
+	}
+
+	RD::DrawListID draw_list = RD::get_singleton()->draw_list_begin(framebuffer, clear ? RD::INITIAL_ACTION_CLEAR : RD::INITIAL_ACTION_KEEP, RD::FINAL_ACTION_READ, RD::INITIAL_ACTION_KEEP, RD::FINAL_ACTION_DISCARD, clear_colors);
+
+	RD::get_singleton()->draw_list_bind_uniform_set(draw_list, fb_uniform_set, BASE_UNIFORM_SET);
+	RD::get_singleton()->draw_list_bind_uniform_set(draw_list, state.default_transforms_uniform_set, TRANSFORMS_UNIFORM_SET);
+
+	_submit_draw_batch(draw_list, r_render_info);
+
 	RD::get_singleton()->draw_list_end();
 }
 
-void RendererCanvasRenderRD::canvas_render_items(RID p_to_render_target, Item *p_item_list, const Color &p_modulate, Light *p_light_list, Light *p_directional_light_list, const Transform2D &p_canvas_transform, RenderingServer::CanvasItemTextureFilter p_default_filter, RenderingServer::CanvasItemTextureRepeat p_default_repeat, bool p_snap_2d_vertices_to_pixel, bool &r_sdf_used) {
+void RendererCanvasRenderRD::canvas_render_items(RID p_to_render_target, Item *p_item_list, const Color &p_modulate, Light *p_light_list, Light *p_directional_light_list, const Transform2D &p_canvas_transform, RenderingServer::CanvasItemTextureFilter p_default_filter, RenderingServer::CanvasItemTextureRepeat p_default_repeat, bool p_snap_2d_vertices_to_pixel, bool &r_sdf_used, RenderingMethod::RenderInfo *r_render_info) {
 	RendererRD::TextureStorage *texture_storage = RendererRD::TextureStorage::get_singleton();
 	RendererRD::MaterialStorage *material_storage = RendererRD::MaterialStorage::get_singleton();
 	RendererRD::MeshStorage *mesh_storage = RendererRD::MeshStorage::get_singleton();
@@ -1495,7 +1670,7 @@ void RendererCanvasRenderRD::canvas_render_items(RID p_to_render_target, Item *p
 					update_skeletons = false;
 				}
 
-				_render_items(p_to_render_target, item_count, canvas_transform_inverse, p_light_list, r_sdf_used);
+				_render_items(p_to_render_target, item_count, canvas_transform_inverse, p_light_list, r_sdf_used, false, r_render_info);
 				item_count = 0;
 
 				if (ci->canvas_group_owner->canvas_group->mode != RS::CANVAS_GROUP_MODE_TRANSPARENT) {
@@ -1527,7 +1702,7 @@ void RendererCanvasRenderRD::canvas_render_items(RID p_to_render_target, Item *p
 				update_skeletons = false;
 			}
 
-			_render_items(p_to_render_target, item_count, canvas_transform_inverse, p_light_list, r_sdf_used, true);
+			_render_items(p_to_render_target, item_count, canvas_transform_inverse, p_light_list, r_sdf_used, true, r_render_info);
 			item_count = 0;
 
 			if (ci->canvas_group->blur_mipmaps) {
@@ -1551,7 +1726,7 @@ void RendererCanvasRenderRD::canvas_render_items(RID p_to_render_target, Item *p
 				update_skeletons = false;
 			}
 
-			_render_items(p_to_render_target, item_count, canvas_transform_inverse, p_light_list, r_sdf_used);
+			_render_items(p_to_render_target, item_count, canvas_transform_inverse, p_light_list, r_sdf_used, false, r_render_info);
 			item_count = 0;
 
 			texture_storage->render_target_copy_to_back_buffer(p_to_render_target, back_buffer_rect, backbuffer_gen_mipmaps);
@@ -1581,7 +1756,7 @@ void RendererCanvasRenderRD::canvas_render_items(RID p_to_render_target, Item *p
 				update_skeletons = false;
 			}
 
-			_render_items(p_to_render_target, item_count, canvas_transform_inverse, p_light_list, r_sdf_used, canvas_group_owner != nullptr);
+			_render_items(p_to_render_target, item_count, canvas_transform_inverse, p_light_list, r_sdf_used, canvas_group_owner != nullptr, r_render_info);
 			//then reset
 			item_count = 0;
 		}
@@ -2532,7 +2707,7 @@ RendererCanvasRenderRD::RendererCanvasRenderRD() {
 		actions.base_uniform_string = "material.";
 		actions.default_filter = ShaderLanguage::FILTER_LINEAR;
 		actions.default_repeat = ShaderLanguage::REPEAT_DISABLE;
-		actions.base_varying_index = 4;
+		actions.base_varying_index = 5;
 
 		actions.global_buffer_array_variable = "global_shader_uniforms.data";
 
@@ -2613,6 +2788,9 @@ RendererCanvasRenderRD::RendererCanvasRenderRD() {
 		state.canvas_state_buffer = RD::get_singleton()->uniform_buffer_create(sizeof(State::Buffer));
 		state.lights_uniform_buffer = RD::get_singleton()->uniform_buffer_create(sizeof(LightUniform) * state.max_lights_per_render);
 
+		state.instance_buffer_capacity = INSTANCE_BUFFER_INITIAL_CAPACITY;
+		state.instance_buffer = RD::get_singleton()->storage_buffer_create(sizeof(InstanceData) * state.instance_buffer_capacity);
+
 		RD::SamplerState shadow_sampler_state;
 		shadow_sampler_state.mag_filter = RD::SAMPLER_FILTER_LINEAR;
 		shadow_sampler_state.min_filter = RD::SAMPLER_FILTER_LINEAR;
@@ -2740,7 +2918,8 @@ void fragment() {
 		material_storage->material_set_shader(default_clip_children_material, default_clip_children_shader);
 	}
 
-	static_assert(sizeof(PushConstant) == 128);
+	static_assert(sizeof(InstanceData) == 128);
+	static_assert(sizeof(PushConstant) == 16);
 }
 
 bool RendererCanvasRenderRD::free(RID p_rid) {
@@ -2807,6 +2986,7 @@ RendererCanvasRenderRD::~RendererCanvasRenderRD() {
 
 		memdelete_arr(state.light_uniforms);
 		RD::get_singleton()->free(state.lights_uniform_buffer);
+		RD::get_singleton()->free(state.instance_buffer);
 	}
 
 	//shadow rendering
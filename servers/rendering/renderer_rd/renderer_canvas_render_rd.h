@@ -112,7 +112,8 @@ class RendererCanvasRenderRD : public RendererCanvasRender {
 		MAX_RENDER_ITEMS = 256 * 1024,
 		MAX_LIGHT_TEXTURES = 1024,
 		MAX_LIGHTS_PER_ITEM = 16,
-		DEFAULT_MAX_LIGHTS_PER_RENDER = 256
+		DEFAULT_MAX_LIGHTS_PER_RENDER = 256,
+		INSTANCE_BUFFER_INITIAL_CAPACITY = 1024
 	};
 
 	/****************/
@@ -229,6 +230,7 @@ class RendererCanvasRenderRD : public RendererCanvasRender {
 		RID vertex_array;
 		RID index_buffer;
 		RID indices;
+		uint32_t count = 0;
 	};
 
 	struct {
@@ -369,6 +371,9 @@ class RendererCanvasRenderRD : public RendererCanvasRender {
 
 		RID default_transforms_uniform_set;
 
+		RID instance_buffer;
+		uint32_t instance_buffer_capacity = 0;
+
 		uint32_t max_lights_per_render;
 		uint32_t max_lights_per_item;
 
@@ -376,7 +381,8 @@ class RendererCanvasRenderRD : public RendererCanvasRender {
 
 	} state;
 
-	struct PushConstant {
+	// Per-draw data, read by the shaders from the instance buffer.
+	struct InstanceData {
 		float world[6];
 		uint32_t flags;
 		uint32_t specular_shininess;
@@ -403,6 +409,53 @@ class RendererCanvasRenderRD : public RendererCanvasRender {
 		uint32_t lights[4];
 	};
 
+	struct PushConstant {
+		uint32_t base_instance_index;
+		uint32_t pad[3];
+	};
+
+	// The instance data must be uploaded before the draw list begins, so the draw list commands of the items
+	// are recorded first and submitted afterwards. Redundant state changes are not recorded, which lets
+	// consecutive draws of rects and primitives be merged into a single instanced draw, even across items.
+	struct DrawCommand {
+		enum Type {
+			TYPE_BIND_PIPELINE,
+			TYPE_BIND_UNIFORM_SET,
+			TYPE_BIND_INDEX_ARRAY,
+			TYPE_BIND_VERTEX_ARRAY,
+			TYPE_SET_BLEND_CONSTANTS,
+			TYPE_ENABLE_SCISSOR,
+			TYPE_DISABLE_SCISSOR,
+			TYPE_DRAW,
+		};
+
+		Type type = TYPE_DRAW;
+		RID rid;
+		uint32_t uniform_set = 0;
+		Color blend_constants;
+		Rect2 scissor_rect;
+
+		bool use_indices = false;
+		bool batchable = false; // Reads its instance data with the instance index, so following ones can be merged.
+		uint32_t instance_index = 0;
+		uint32_t instance_count = 1;
+		uint32_t primitive_count = 0;
+	};
+
+	struct {
+		LocalVector<DrawCommand> commands;
+		LocalVector<InstanceData> instances;
+
+		RID pipeline;
+		RID uniform_sets[CANVAS_TEXTURE_UNIFORM_SET + 1];
+		RID index_array;
+		RID vertex_array;
+		bool blend_constants_set = false;
+		Color blend_constants;
+		bool scissor_enabled = false;
+		Rect2 scissor_rect;
+	} draw_batch;
+
 	Item *items[MAX_RENDER_ITEMS];
 
 	bool using_directional_lights = false;
@@ -422,9 +475,18 @@ class RendererCanvasRenderRD : public RendererCanvasRender {
 	Color debug_redraw_color;
 	double debug_redraw_time = 1.0;
 
-	inline void _bind_canvas_texture(RD::DrawListID p_draw_list, RID p_texture, RS::CanvasItemTextureFilter p_base_filter, RS::CanvasItemTextureRepeat p_base_repeat, RID &r_last_texture, PushConstant &push_constant, Size2 &r_texpixel_size, bool p_texture_is_data = false); //recursive, so regular inline used instead.
-	void _render_item(RenderingDevice::DrawListID p_draw_list, RID p_render_target, const Item *p_item, RenderingDevice::FramebufferFormatID p_framebuffer_format, const Transform2D &p_canvas_transform_inverse, Item *&current_clip, Light *p_lights, PipelineVariants *p_pipeline_variants, bool &r_sdf_used);
-	void _render_items(RID p_to_render_target, int p_item_count, const Transform2D &p_canvas_transform_inverse, Light *p_lights, bool &r_sdf_used, bool p_to_backbuffer = false);
+	_FORCE_INLINE_ void _record_bind_pipeline(RID p_pipeline);
+	_FORCE_INLINE_ void _record_bind_uniform_set(RID p_uniform_set, uint32_t p_set);
+	_FORCE_INLINE_ void _record_bind_index_array(RID p_index_array);
+	_FORCE_INLINE_ void _record_bind_vertex_array(RID p_vertex_array);
+	_FORCE_INLINE_ void _record_set_blend_constants(const Color &p_color);
+	_FORCE_INLINE_ void _record_scissor(bool p_enable, const Rect2 &p_rect = Rect2());
+	_FORCE_INLINE_ void _record_draw(const InstanceData &p_instance, bool p_use_indices, uint32_t p_primitive_count, bool p_batchable, uint32_t p_instance_count = 1);
+	void _submit_draw_batch(RD::DrawListID p_draw_list, RenderingMethod::RenderInfo *r_render_info);
+
+	inline void _bind_canvas_texture(RID p_texture, RS::CanvasItemTextureFilter p_base_filter, RS::CanvasItemTextureRepeat p_base_repeat, RID &r_last_texture, InstanceData &r_instance_data, Size2 &r_texpixel_size, bool p_texture_is_data = false); //recursive, so regular inline used instead.
+	void _render_item(RID p_render_target, const Item *p_item, RenderingDevice::FramebufferFormatID p_framebuffer_format, const Transform2D &p_canvas_transform_inverse, Item *&current_clip, Light *p_lights, PipelineVariants *p_pipeline_variants, bool &r_sdf_used);
+	void _render_items(RID p_to_render_target, int p_item_count, const Transform2D &p_canvas_transform_inverse, Light *p_lights, bool &r_sdf_used, bool p_to_backbuffer = false, RenderingMethod::RenderInfo *r_render_info = nullptr);
 
 	_FORCE_INLINE_ void _update_transform_2d_to_mat2x4(const Transform2D &p_transform, float *p_mat2x4);
 	_FORCE_INLINE_ void _update_transform_2d_to_mat2x3(const Transform2D &p_transform, float *p_mat2x3);
@@ -450,7 +512,7 @@ public:
 	void occluder_polygon_set_shape(RID p_occluder, const Vector<Vector2> &p_points, bool p_closed);
 	void occluder_polygon_set_cull_mode(RID p_occluder, RS::CanvasOccluderPolygonCullMode p_mode);
 
-	void canvas_render_items(RID p_to_render_target, Item *p_item_list, const Color &p_modulate, Light *p_light_list, Light *p_directional_light_list, const Transform2D &p_canvas_transform, RS::CanvasItemTextureFilter p_default_filter, RS::CanvasItemTextureRepeat p_default_repeat, bool p_snap_2d_vertices_to_pixel, bool &r_sdf_used);
+	void canvas_render_items(RID p_to_render_target, Item *p_item_list, const Color &p_modulate, Light *p_light_list, Light *p_directional_light_list, const Transform2D &p_canvas_transform, RS::CanvasItemTextureFilter p_default_filter, RS::CanvasItemTextureRepeat p_default_repeat, bool p_snap_2d_vertices_to_pixel, bool &r_sdf_used, RenderingMethod::RenderInfo *r_render_info = nullptr);
 
 	virtual void set_shadow_texture_size(int p_size);
 
@@ -26,6 +26,8 @@ layout(location = 3) out vec2 pixel_size_interp;
 
 #endif
 
+layout(location = 4) flat out uint instance_index_interp;
+
 #ifdef MATERIAL_UNIFORMS_USED
 layout(set = 1, binding = 0, std140) uniform MaterialUniforms{
 
@@ -43,6 +45,15 @@ vec3 srgb_to_linear(vec3 color) {
 #endif
 
 void main() {
+#ifdef USE_ATTRIBUTES
+	// Draws with attributes use the instance index for multimesh and particles, they are never merged.
+	uint instance_index = params.base_instance_index;
+#else
+	uint instance_index = params.base_instance_index + gl_InstanceIndex;
+#endif
+	instance_index_interp = instance_index;
+	draw_data = instances.data[instance_index];
+
 	vec4 instance_custom = vec4(0.0);
 #ifdef USE_PRIMITIVE
 
@@ -235,6 +246,8 @@ layout(location = 3) in vec2 pixel_size_interp;
 
 #endif
 
+layout(location = 4) flat in uint instance_index_interp;
+
 layout(location = 0) out vec4 frag_color;
 
 #ifdef MATERIAL_UNIFORMS_USED
@@ -442,6 +455,8 @@ float msdf_median(float r, float g, float b, float a) {
 }
 
 void main() {
+	draw_data = instances.data[instance_index_interp];
+
 	vec4 color = color_interp;
 	vec2 uv = uv_interp;
 	vec2 vertex = vertex_interp;
@@ -30,9 +30,9 @@
 #define FLAGS_FLIP_H (1 << 30)
 #define FLAGS_FLIP_V (1 << 31)
 
-// Push Constant
+// Instance Data
 
-layout(push_constant, std430) uniform DrawData {
+struct InstanceData {
 	vec2 world_x;
 	vec2 world_y;
 	vec2 world_ofs;
@@ -52,8 +52,17 @@ layout(push_constant, std430) uniform DrawData {
 #endif
 	vec2 color_texture_pixel_size;
 	uint lights[4];
+};
+
+// Push Constant
+
+layout(push_constant, std430) uniform Params {
+	uint base_instance_index;
+	uint pad1;
+	uint pad2;
+	uint pad3;
 }
-draw_data;
+params;
 
 // In vulkan, sets should always be ordered using the following logic:
 // Lower Sets: Sets that change format and layout less often
@@ -127,6 +136,15 @@ layout(set = 0, binding = 5) uniform sampler shadow_sampler;
 layout(set = 0, binding = 6) uniform texture2D color_buffer;
 layout(set = 0, binding = 7) uniform texture2D sdf_texture;
 
+// Indexed with params.base_instance_index, plus the instance index for draws merged into one instanced draw.
+layout(set = 0, binding = 8, std430) restrict readonly buffer Instances {
+	InstanceData data[];
+}
+instances;
+
+// Instance data of the current draw, read at the beginning of each stage.
+InstanceData draw_data;
+
 #include "samplers_inc.glsl"
 
 layout(set = 0, binding = 9, std430) restrict readonly buffer GlobalShaderUniformData {
@@ -927,6 +927,63 @@ void RendererSceneCull::instance_set_transform(RID p_instance, const Transform3D
 	_instance_queue_update(instance, true);
 }
 
+void RendererSceneCull::instances_set_transforms(const Vector<RID> &p_instances, const Vector<float> &p_transforms) {
+	const int instance_count = p_instances.size();
+	ERR_FAIL_COND_MSG(p_transforms.size() != instance_count * 12, "The transforms array must contain 12 floats per instance.");
+
+	const RID *instances = p_instances.ptr();
+	const float *transforms = p_transforms.ptr();
+
+	// Instances without other pending changes are updated right away instead of going through the update list.
+	// Geometry goes first, with its indexer refit once at the end, as only the other instances pair against that indexer.
+	instance_transform_batch.clear();
+	geometry_indexer_refit = true;
+
+	for (int i = 0; i < instance_count; i++) {
+		Instance *instance = instance_owner.get_or_null(instances[i]);
+		ERR_CONTINUE(!instance);
+
+		const float *t = &transforms[i * 12];
+		Transform3D transform;
+		transform.basis.rows[0] = Vector3(t[0], t[1], t[2]);
+		transform.basis.rows[1] = Vector3(t[4], t[5], t[6]);
+		transform.basis.rows[2] = Vector3(t[8], t[9], t[10]);
+		transform.origin = Vector3(t[3], t[7], t[11]);
+
+		if (instance->transform == transform) {
+			continue;
+		}
+
+#ifdef DEBUG_ENABLED
+		ERR_CONTINUE_MSG(!transform.is_finite(), "Skipping an instance with a non-finite transform.");
+#endif
+		instance->transform = transform;
+
+		if (instance->update_item.in_list()) {
+			_instance_queue_update(instance, true);
+		} else if ((1 << instance->base_type) & RS::INSTANCE_GEOMETRY_MASK) {
+			_update_instance_aabb(instance);
+			_update_instance(instance);
+		} else {
+			instance_transform_batch.push_back(instance);
+		}
+	}
+
+	geometry_indexer_refit = false;
+	for (Scenario *scenario : geometry_refit_scenarios) {
+		scenario->indexers[Scenario::INDEXER_GEOMETRY].refit(scenario->geometry_refit_ids.ptr(), scenario->geometry_refit_aabbs.ptr(), scenario->geometry_refit_ids.size());
+		scenario->geometry_refit_ids.clear();
+		scenario->geometry_refit_aabbs.clear();
+	}
+	geometry_refit_scenarios.clear();
+
+	for (Instance *instance : instance_transform_batch) {
+		_update_instance_aabb(instance);
+		_update_instance(instance);
+	}
+	instance_transform_batch.clear();
+}
+
 void RendererSceneCull::instance_attach_object_instance_id(RID p_instance, ObjectID p_id) {
 	Instance *instance = instance_owner.get_or_null(p_instance);
 	ERR_FAIL_NULL(instance);
@@ -1783,7 +1840,16 @@ void RendererSceneCull::_update_instance(Instance *p_instance) {
 		_update_instance_visibility_dependencies(p_instance);
 	} else {
 		if ((1 << p_instance->base_type) & RS::INSTANCE_GEOMETRY_MASK) {
-			p_instance->scenario->indexers[Scenario::INDEXER_GEOMETRY].update(p_instance->indexer_id, bvh_aabb);
+			if (geometry_indexer_refit) {
+				Scenario *scenario = p_instance->scenario;
+				if (scenario->geometry_refit_ids.is_empty()) {
+					geometry_refit_scenarios.push_back(scenario);
+				}
+				scenario->geometry_refit_ids.push_back(p_instance->indexer_id);
+				scenario->geometry_refit_aabbs.push_back(bvh_aabb);
+			} else {
+				p_instance->scenario->indexers[Scenario::INDEXER_GEOMETRY].update(p_instance->indexer_id, bvh_aabb);
+			}
 		} else {
 			p_instance->scenario->indexers[Scenario::INDEXER_VOLUMES].update(p_instance->indexer_id, bvh_aabb);
 		}
@@ -32,6 +32,7 @@
 #define TEST_FILE_ACCESS_H
 
 #include "core/io/file_access.h"
+#include "core/io/file_access_memory.h"
 #include "tests/test_macros.h"
 #include "tests/test_utils.h"
 
@@ -107,6 +108,40 @@ TEST_CASE("[FileAccess] Get as UTF-8 String") {
 	CHECK(s_cr == "Hello darkness\rMy old friend\rI've come to talk\rWith you again\r");
 	CHECK(s_cr_nocr == "Hello darknessMy old friendI've come to talkWith you again");
 }
+
+TEST_CASE("[FileAccess] Read through a memory mapping") {
+	const String path = OS::get_singleton()->get_cache_path().path_join("mapped.bin");
+	{
+		Ref<FileAccess> f = FileAccess::open(path, FileAccess::WRITE);
+		REQUIRE(!f.is_null());
+		f->store_16(0x1234);
+		f->store_32(0x12345678);
+		f->store_64(0x123456789abcdef0);
+		f->set_big_endian(true);
+		f->store_32(0x12345678);
+		f->store_8(0xff);
+	}
+
+	Ref<FileAccess> f = FileAccess::open(path, FileAccess::READ);
+	REQUIRE(!f.is_null());
+	const uint8_t *mapped = f->map_read_only();
+	if (!mapped) {
+		return; // Not supported by the file backend of this platform.
+	}
+	CHECK_EQ(mapped[0], 0x34);
+
+	Ref<FileAccessMemory> fm;
+	fm.instantiate();
+	REQUIRE_EQ(fm->open_custom(mapped, f->get_length()), OK);
+	CHECK_EQ(fm->get_16(), 0x1234);
+	CHECK_EQ(fm->get_32(), 0x12345678u);
+	CHECK_EQ(fm->get_64(), 0x123456789abcdef0u);
+	fm->set_big_endian(true);
+	CHECK_EQ(fm->get_32(), 0x12345678u);
+	// Reading past the end should behave like reading byte by byte.
+	CHECK_EQ(fm->get_32(), 0xffu << 24);
+	CHECK(fm->eof_reached());
+}
 } // namespace TestFileAccess
 
 #endif // TEST_FILE_ACCESS_H
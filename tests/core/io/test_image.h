@@ -208,6 +208,59 @@ TEST_CASE("[Image] Resizing") {
 			"get_size() should return the correct size after resize_to_po2().");
 }
 
+TEST_CASE("[Image] Resizing and generating mipmaps of large images") {
+	// Large enough to be split into bands of rows processed on several threads.
+	const int src_width = 700;
+	const int src_height = 600;
+	Vector<uint8_t> src_data;
+	src_data.resize(src_width * src_height);
+	uint8_t *src_ptr = src_data.ptrw();
+	for (int y = 0; y < src_height; y++) {
+		for (int x = 0; x < src_width; x++) {
+			src_ptr[y * src_width + x] = (x * 7 + y * 13) % 256;
+		}
+	}
+	Ref<Image> image = memnew(Image(src_width, src_height, false, Image::FORMAT_L8, src_data));
+
+	const int dst_width = 900;
+	const int dst_height = 1000;
+	Ref<Image> image_resized = image->duplicate();
+	image_resized->resize(dst_width, dst_height, Image::INTERPOLATE_NEAREST);
+	const uint8_t *dst_ptr = image_resized->get_data().ptr();
+	bool resize_matches = true;
+	for (int y = 0; y < dst_height && resize_matches; y++) {
+		for (int x = 0; x < dst_width; x++) {
+			if (dst_ptr[y * dst_width + x] != src_ptr[(y * src_height / dst_height) * src_width + x * src_width / dst_width]) {
+				resize_matches = false;
+				break;
+			}
+		}
+	}
+	CHECK_MESSAGE(
+			resize_matches,
+			"Every row of a large image should be resized.");
+
+	Ref<Image> image_mipmaps = memnew(Image(src_width, src_height, false, Image::FORMAT_L8, src_data));
+	CHECK(image_mipmaps->generate_mipmaps() == OK);
+	const int mip_width = src_width / 2;
+	const int mip_height = src_height / 2;
+	const uint8_t *mip_ptr = image_mipmaps->get_data().ptr() + image_mipmaps->get_mipmap_offset(1);
+	bool mipmap_matches = true;
+	for (int y = 0; y < mip_height && mipmap_matches; y++) {
+		for (int x = 0; x < mip_width; x++) {
+			const uint8_t *up = &src_ptr[y * 2 * src_width + x * 2];
+			const uint8_t *down = up + src_width;
+			if (mip_ptr[y * mip_width + x] != ((up[0] + up[1] + down[0] + down[1] + 2) >> 2)) {
+				mipmap_matches = false;
+				break;
+			}
+		}
+	}
+	CHECK_MESSAGE(
+			mipmap_matches,
+			"Every row of the first mipmap of a large image should be generated.");
+}
+
 TEST_CASE("[Image] Modifying pixels of an image") {
 	Ref<Image> image = memnew(Image(3, 3, false, Image::FORMAT_RGBA8));
 	image->set_pixel(0, 0, Color(1, 1, 1, 1));
@@ -0,0 +1,100 @@
+/**************************************************************************/
+/*  test_dynamic_bvh.h                                                    */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#ifndef TEST_DYNAMIC_BVH_H
+#define TEST_DYNAMIC_BVH_H
+
+#include "core/math/dynamic_bvh.h"
+
+#include "thirdparty/doctest/doctest.h"
+
+namespace TestDynamicBVH {
+
+struct QueryCollector {
+	Vector<int> found;
+
+	bool operator()(void *p_data) {
+		found.push_back(int(intptr_t(p_data)));
+		return false;
+	}
+};
+
+static Vector<int> query_sorted(DynamicBVH &p_bvh, const AABB &p_aabb) {
+	QueryCollector collector;
+	p_bvh.aabb_query(p_aabb, collector);
+	collector.found.sort();
+	return collector.found;
+}
+
+static Vector<int> brute_force_sorted(const LocalVector<AABB> &p_boxes, const AABB &p_aabb) {
+	Vector<int> found;
+	for (uint32_t i = 0; i < p_boxes.size(); i++) {
+		if (p_boxes[i].intersects_inclusive(p_aabb)) {
+			found.push_back(i);
+		}
+	}
+	return found;
+}
+
+TEST_CASE("[DynamicBVH] Refit should keep queries exact") {
+	DynamicBVH bvh;
+	LocalVector<AABB> boxes;
+	LocalVector<DynamicBVH::ID> ids;
+	for (int i = 0; i < 100; i++) {
+		const AABB box(Vector3(i % 10, 0, i / 10) * 2.0, Vector3(1, 1, 1));
+		boxes.push_back(box);
+		ids.push_back(bvh.insert(box, (void *)intptr_t(i)));
+	}
+
+	// Small moves keep their place in the tree, the last ones move far enough to be reinserted.
+	for (int i = 0; i < 100; i++) {
+		if (i < 90) {
+			boxes[i].position += Vector3(0.5, 0.25, (i % 3) * 0.25);
+		} else {
+			boxes[i].position += Vector3(-50, 10, 30);
+		}
+	}
+	bvh.refit(ids.ptr(), boxes.ptr(), ids.size());
+
+	const AABB queries[] = {
+		AABB(Vector3(-1, -1, -1), Vector3(4, 4, 4)),
+		AABB(Vector3(5, 0, 5), Vector3(3, 0.5, 3)),
+		AABB(Vector3(-50, 10, 30), Vector3(20, 2, 20)),
+		AABB(Vector3(-100, -100, -100), Vector3(200, 200, 200)),
+	};
+	for (const AABB &query : queries) {
+		CHECK_EQ(query_sorted(bvh, query), brute_force_sorted(boxes, query));
+	}
+	CHECK_EQ(bvh.get_leaf_count(), 100);
+}
+
+} // namespace TestDynamicBVH
+
+#endif // TEST_DYNAMIC_BVH_H
@@ -321,6 +321,133 @@ TEST_CASE("[Expression] Expressions with variables") {
 	ERR_PRINT_ON;
 }
 
+static Array build_inputs(const Variant &p_value) {
+	Array inputs;
+	inputs.push_back(p_value);
+	return inputs;
+}
+
+TEST_CASE("[Expression] Calling built-in methods on inputs of different types") {
+	Expression expression;
+
+	PackedStringArray parameter_names;
+	parameter_names.push_back("value");
+	CHECK_MESSAGE(
+			expression.parse("value.length()", parameter_names) == OK,
+			"The expression should parse successfully.");
+
+	// The method is resolved again whenever the type of the base changes.
+	CHECK_MESSAGE(
+			double(expression.execute(build_inputs(Vector2(3, 4)))) == doctest::Approx(5),
+			"The expression should return the expected value.");
+	CHECK_MESSAGE(
+			double(expression.execute(build_inputs(Vector2(6, 8)))) == doctest::Approx(10),
+			"The expression should return the expected value.");
+	CHECK_MESSAGE(
+			int(expression.execute(build_inputs("hello"))) == 5,
+			"The expression should return the expected value.");
+	CHECK_MESSAGE(
+			double(expression.execute(build_inputs(Vector3(2, 3, 6)))) == doctest::Approx(7),
+			"The expression should return the expected value.");
+
+	ERR_PRINT_OFF;
+	expression.execute(build_inputs(42));
+	CHECK_MESSAGE(
+			expression.has_execute_failed(),
+			"Calling a method the type doesn't have should fail.");
+	ERR_PRINT_ON;
+
+	CHECK_MESSAGE(
+			expression.parse("value.append(1)", parameter_names) == OK,
+			"The expression should parse successfully.");
+	ERR_PRINT_OFF;
+	expression.execute(build_inputs(Array()), nullptr, true, true);
+	CHECK_MESSAGE(
+			expression.has_execute_failed(),
+			"Calling a non-const method should fail when only const calls are allowed.");
+	ERR_PRINT_ON;
+}
+
+TEST_CASE("[Expression] Constant expressions") {
+	Expression expression;
+
+	CHECK_MESSAGE(
+			expression.parse("Vector2(1, 2) * 3 + Vector2(0.5, 0.5)") == OK,
+			"The expression should parse successfully.");
+	CHECK_MESSAGE(
+			Vector2(expression.execute()).is_equal_approx(Vector2(3.5, 6.5)),
+			"The expression should return the expected value.");
+
+	// Arrays are shared by reference, so each execution must return a new one.
+	CHECK_MESSAGE(
+			expression.parse("[1, 2] + [3]") == OK,
+			"The expression should parse successfully.");
+	Array first = expression.execute();
+	first.push_back(4);
+	Array second = expression.execute();
+	CHECK_MESSAGE(
+			second.size() == 3,
+			"Modifying a returned array should not affect later executions.");
+
+	CHECK_MESSAGE(
+			expression.parse("10 / 0") == OK,
+			"The expression should parse successfully.");
+	ERR_PRINT_OFF;
+	expression.execute();
+	CHECK_MESSAGE(
+			expression.has_execute_failed(),
+			"Integer division by zero should fail when executed.");
+	ERR_PRINT_ON;
+}
+
+TEST_CASE("[Expression] Executing with many inputs") {
+	Expression expression;
+
+	PackedStringArray parameter_names;
+	parameter_names.push_back("a");
+	parameter_names.push_back("b");
+	CHECK_MESSAGE(
+			expression.parse("a * b + a", parameter_names) == OK,
+			"The expression should parse successfully.");
+
+	Array inputs_array;
+	for (int i = 0; i < 4; i++) {
+		Array inputs;
+		inputs.push_back(i);
+		inputs.push_back(i + 1);
+		inputs_array.push_back(inputs);
+	}
+	Array float_inputs;
+	float_inputs.push_back(1.5);
+	float_inputs.push_back(2);
+	inputs_array.push_back(float_inputs);
+	Array vector_inputs;
+	vector_inputs.push_back(Vector2(1, 2));
+	vector_inputs.push_back(2);
+	inputs_array.push_back(vector_inputs);
+
+	Array outputs = expression.execute_many(inputs_array);
+	CHECK_FALSE(expression.has_execute_failed());
+	REQUIRE(outputs.size() == 6);
+	CHECK(int(outputs[0]) == 0);
+	CHECK(int(outputs[1]) == 3);
+	CHECK(int(outputs[2]) == 8);
+	CHECK(int(outputs[3]) == 15);
+	CHECK(double(outputs[4]) == doctest::Approx(4.5));
+	CHECK(Vector2(outputs[5]).is_equal_approx(Vector2(3, 6)));
+
+	// Stops at the first failure, returning the results computed until then.
+	Array invalid_inputs;
+	invalid_inputs.push_back("text");
+	invalid_inputs.push_back(Vector3());
+	inputs_array.insert(2, invalid_inputs);
+	ERR_PRINT_OFF;
+	outputs = expression.execute_many(inputs_array);
+	ERR_PRINT_ON;
+	CHECK(expression.has_execute_failed());
+	CHECK(outputs.size() == 2);
+}
+
 TEST_CASE("[Expression] Invalid expressions") {
 	Expression expression;
 
@@ -361,6 +488,45 @@ TEST_CASE("[Expression] Invalid expressions") {
 			"The expression shouldn't parse successfully.");
 }
 
+TEST_CASE("[Expression] Invalid operands when executing") {
+	Expression expression;
+
+	PackedStringArray parameter_names;
+	parameter_names.push_back("format");
+	parameter_names.push_back("value");
+	CHECK_MESSAGE(
+			expression.parse("format % value", parameter_names) == OK,
+			"The expression should parse successfully.");
+
+	Array valid_inputs;
+	valid_inputs.push_back("%d apples");
+	valid_inputs.push_back(5);
+	CHECK_MESSAGE(
+			String(expression.execute(valid_inputs)) == "5 apples",
+			"The string should be formatted.");
+	CHECK_FALSE(expression.has_execute_failed());
+
+	Array invalid_inputs;
+	invalid_inputs.push_back("%d apples");
+	invalid_inputs.push_back("five");
+	ERR_PRINT_OFF;
+	expression.execute(invalid_inputs);
+	ERR_PRINT_ON;
+	CHECK_MESSAGE(
+			expression.has_execute_failed(),
+			"Formatting a string with an argument of the wrong type should fail.");
+
+	Array string_name_inputs;
+	string_name_inputs.push_back(StringName("%d apples"));
+	string_name_inputs.push_back("five");
+	ERR_PRINT_OFF;
+	expression.execute(string_name_inputs);
+	ERR_PRINT_ON;
+	CHECK_MESSAGE(
+			expression.has_execute_failed(),
+			"Formatting a StringName with an argument of the wrong type should fail.");
+}
+
 TEST_CASE("[Expression] Unusual expressions") {
 	Expression expression;
 
@@ -284,6 +284,17 @@ TEST_CASE("[Object] Absent name getter") {
 			"The returned value should equal nil variant.");
 }
 
+class SignalReceiverObject : public Object {
+	GDCLASS(SignalReceiverObject, Object);
+
+public:
+	int calls = 0;
+
+	void receive() {
+		calls++;
+	}
+};
+
 TEST_CASE("[Object] Signals") {
 	Object object;
 
@@ -402,6 +413,37 @@ TEST_CASE("[Object] Signals") {
 		SIGNAL_UNWATCH(&object, "my_custom_signal");
 	}
 
+	SUBCASE("Emitting a signal should call every connected method once") {
+		SignalReceiverObject receivers[40];
+		// Enough slots to need the heap fallback too.
+		const int slot_counts[] = { 0, 1, 8, 40 };
+
+		for (int slot_count : slot_counts) {
+			for (int i = 0; i < slot_count; i++) {
+				receivers[i].calls = 0;
+				object.connect("my_custom_signal", callable_mp(&receivers[i], &SignalReceiverObject::receive));
+			}
+
+			for (int i = 0; i < 10; i++) {
+				CHECK(object.emit_signal("my_custom_signal") == OK);
+			}
+			for (int i = 0; i < slot_count; i++) {
+				CHECK(receivers[i].calls == 10);
+				object.disconnect("my_custom_signal", callable_mp(&receivers[i], &SignalReceiverObject::receive));
+			}
+		}
+	}
+
+	SUBCASE("One-shot connections should be called once and then removed") {
+		SignalReceiverObject receiver;
+		object.connect("my_custom_signal", callable_mp(&receiver, &SignalReceiverObject::receive), Object::CONNECT_ONE_SHOT);
+
+		CHECK(object.emit_signal("my_custom_signal") == OK);
+		CHECK(object.emit_signal("my_custom_signal") == OK);
+		CHECK(receiver.calls == 1);
+		CHECK_FALSE(object.is_connected("my_custom_signal", callable_mp(&receiver, &SignalReceiverObject::receive)));
+	}
+
 	SUBCASE("Connecting and then disconnecting many signals should not leave anything behind") {
 		List<Object::Connection> signal_connections;
 		Object targets[100];
@@ -0,0 +1,118 @@
+/**************************************************************************/
+/*  test_memory.h                                                         */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#ifndef TEST_MEMORY_H
+#define TEST_MEMORY_H
+
+#include "core/object/worker_thread_pool.h"
+#include "core/os/memory.h"
+#include "core/templates/safe_refcount.h"
+
+#include "tests/test_macros.h"
+
+namespace TestMemory {
+
+static bool fill_and_check(uint8_t *p_mem, size_t p_size, uint8_t p_value, size_t p_check_size) {
+	bool valid = true;
+	for (size_t i = 0; i < p_check_size; i++) {
+		if (p_mem[i] != p_value) {
+			valid = false;
+		}
+	}
+	for (size_t i = 0; i < p_size; i++) {
+		p_mem[i] = p_value + 1;
+	}
+	return valid;
+}
+
+TEST_CASE("[Memory] Allocating, reallocating and freeing") {
+	// Sizes cross the small object size classes and go beyond them.
+	const size_t sizes[] = { 0, 1, 15, 16, 17, 100, 240, 241, 256, 1000, 100000 };
+	const uint64_t mem_usage = Memory::get_mem_usage();
+
+	for (size_t size : sizes) {
+		for (bool pad : { false, true }) {
+			uint8_t *mem = (uint8_t *)Memory::alloc_static(size, pad);
+			REQUIRE(mem != nullptr);
+			CHECK(((uintptr_t)mem % 8) == 0);
+			fill_and_check(mem, size, 0, 0);
+
+			size_t cur_size = size;
+			for (size_t new_size : sizes) {
+				if (new_size == 0) {
+					continue;
+				}
+				mem = (uint8_t *)Memory::realloc_static(mem, new_size, pad);
+				REQUIRE(mem != nullptr);
+				CHECK_MESSAGE(fill_and_check(mem, new_size, 1, MIN(cur_size, new_size)), "Contents should be kept when reallocating.");
+				fill_and_check(mem, new_size, 0, 0);
+				cur_size = new_size;
+			}
+
+			Memory::free_static(mem, pad);
+		}
+	}
+
+	CHECK(Memory::get_mem_usage() == mem_usage);
+}
+
+static SafeNumeric<uint32_t> corrupted_blocks;
+
+static void allocate_on_thread(void *p_userdata, uint32_t p_index) {
+	const uint32_t block_count = 512;
+	uint8_t *blocks[block_count];
+	for (uint32_t i = 0; i < block_count; i++) {
+		blocks[i] = (uint8_t *)Memory::alloc_static(i % 300);
+		memset(blocks[i], p_index, i % 300);
+	}
+	for (uint32_t i = 0; i < block_count; i += 2) {
+		Memory::free_static(blocks[i]);
+	}
+	for (uint32_t i = 1; i < block_count; i += 2) {
+		for (uint32_t j = 0; j < i % 300; j++) {
+			if (blocks[i][j] != (uint8_t)p_index) {
+				corrupted_blocks.increment();
+				break;
+			}
+		}
+		Memory::free_static(blocks[i]);
+	}
+}
+
+TEST_CASE("[Memory] Allocating from several threads") {
+	corrupted_blocks.set(0);
+	WorkerThreadPool::GroupID group_task = WorkerThreadPool::get_singleton()->add_native_group_task(&allocate_on_thread, nullptr, 64, -1, true);
+	WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group_task);
+	CHECK(corrupted_blocks.get() == 0);
+}
+
+} // namespace TestMemory
+
+#endif // TEST_MEMORY_H
@@ -0,0 +1,93 @@
+/**************************************************************************/
+/*  test_string_name.h                                                    */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#ifndef TEST_STRING_NAME_H
+#define TEST_STRING_NAME_H
+
+#include "core/object/worker_thread_pool.h"
+#include "core/string/string_name.h"
+
+#include "tests/test_macros.h"
+
+namespace TestStringName {
+
+TEST_CASE("[StringName] Interning") {
+	const StringName a = "test_string_name_interning";
+	const StringName b = String("test_string_name_interning");
+	const StringName c = StringName(a);
+
+	CHECK(a == b);
+	CHECK(a == c);
+	CHECK(a.data_unique_pointer() == b.data_unique_pointer());
+	CHECK(a == "test_string_name_interning");
+	CHECK(a != StringName("test_string_name_interning_other"));
+	CHECK(StringName::search("test_string_name_interning") == a);
+	CHECK(StringName::search("test_string_name_interning_missing") == StringName());
+}
+
+static const uint32_t THREADED_NAME_COUNT = 512;
+static LocalVector<StringName> threaded_names;
+
+static void threaded_intern(void *p_userdata, uint32_t p_index) {
+	// Every name is built many times over from several threads, while the
+	// temporaries are released, so both paths touching the table contend.
+	const uint32_t name_index = p_index % THREADED_NAME_COUNT;
+	const String name = "test_string_name_threaded_" + itos(name_index);
+	for (int i = 0; i < 64; i++) {
+		StringName temp = name;
+		if (temp != threaded_names[name_index]) {
+			((SafeNumeric<uint32_t> *)p_userdata)->increment();
+		}
+	}
+}
+
+TEST_CASE("[StringName] Concurrent interning returns the same names") {
+	threaded_names.resize(THREADED_NAME_COUNT);
+	for (uint32_t i = 0; i < THREADED_NAME_COUNT; i++) {
+		threaded_names[i] = "test_string_name_threaded_" + itos(i);
+	}
+
+	SafeNumeric<uint32_t> mismatches;
+	WorkerThreadPool::GroupID group = WorkerThreadPool::get_singleton()->add_native_group_task(threaded_intern, &mismatches, THREADED_NAME_COUNT * 16, -1, true);
+	WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group);
+
+	CHECK(mismatches.get() == 0);
+	for (uint32_t i = 0; i < THREADED_NAME_COUNT; i++) {
+		CHECK(StringName::search("test_string_name_threaded_" + itos(i)) == threaded_names[i]);
+	}
+	threaded_names.clear();
+
+	// Once the last reference is gone, names are removed from the table.
+	CHECK(StringName::search("test_string_name_threaded_0") == StringName());
+}
+
+} // namespace TestStringName
+
+#endif // TEST_STRING_NAME_H
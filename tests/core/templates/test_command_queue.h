@@ -36,6 +36,7 @@
 #include "core/os/os.h"
 #include "core/os/thread.h"
 #include "core/templates/command_queue_mt.h"
+#include "core/templates/safe_refcount.h"
 #include "tests/test_macros.h"
 
 namespace TestCommandQueue {
@@ -381,6 +382,77 @@ TEST_CASE("[CommandQueue] Test Queue Lapping") {
 			ProjectSettings::get_singleton()->property_get_revert(COMMAND_QUEUE_SETTING));
 }
 
+class MultiProducerState {
+public:
+	static const int PRODUCER_COUNT = 4;
+	static const int COMMANDS_PER_PRODUCER = 1024;
+
+	CommandQueueMT command_queue = CommandQueueMT(false);
+	SafeNumeric<int> next_producer;
+	SafeNumeric<int> producers_done;
+	SafeNumeric<int> return_errors;
+
+	// Only touched by the thread flushing the queue.
+	int received[PRODUCER_COUNT] = {};
+	int ordering_errors = 0;
+
+	void receive(int p_producer, int p_index) {
+		if (received[p_producer] != p_index) {
+			ordering_errors++;
+		}
+		received[p_producer]++;
+	}
+	int receive_ret(int p_producer, int p_index) {
+		receive(p_producer, p_index);
+		return p_index;
+	}
+
+	static void producer_main(void *p_userdata) {
+		MultiProducerState *mps = static_cast<MultiProducerState *>(p_userdata);
+		int producer = mps->next_producer.postincrement();
+		for (int i = 0; i < COMMANDS_PER_PRODUCER; i++) {
+			if (i % 64 == 63) {
+				mps->command_queue.push_and_sync(mps, &MultiProducerState::receive, producer, i);
+			} else if (i % 64 == 31) {
+				int ret = -1;
+				mps->command_queue.push_and_ret(mps, &MultiProducerState::receive_ret, producer, i, &ret);
+				if (ret != i) {
+					mps->return_errors.increment();
+				}
+			} else {
+				mps->command_queue.push(mps, &MultiProducerState::receive, producer, i);
+			}
+		}
+		mps->producers_done.increment();
+	}
+};
+
+TEST_CASE("[CommandQueue] Test multiple producers") {
+	MultiProducerState mps;
+	Thread producers[MultiProducerState::PRODUCER_COUNT];
+	for (int i = 0; i < MultiProducerState::PRODUCER_COUNT; i++) {
+		producers[i].start(&MultiProducerState::producer_main, &mps);
+	}
+
+	// Producers waiting on synced commands are released by these flushes.
+	while (mps.producers_done.get() < MultiProducerState::PRODUCER_COUNT) {
+		mps.command_queue.flush_all();
+	}
+	for (int i = 0; i < MultiProducerState::PRODUCER_COUNT; i++) {
+		producers[i].wait_to_finish();
+	}
+	mps.command_queue.flush_all();
+
+	CHECK_MESSAGE(mps.ordering_errors == 0,
+			"Commands from the same thread should run in the order they were pushed.");
+	CHECK_MESSAGE(mps.return_errors.get() == 0,
+			"Commands pushed with a return value should return to the thread that pushed them.");
+	for (int i = 0; i < MultiProducerState::PRODUCER_COUNT; i++) {
+		CHECK_MESSAGE(mps.received[i] == MultiProducerState::COMMANDS_PER_PRODUCER,
+				"All the commands pushed should be run.");
+	}
+}
+
 TEST_CASE("[Stress][CommandQueue] Stress test command queue") {
 	const char *COMMAND_QUEUE_SETTING = "memory/limits/command_queue/multithreading_queue_size_kb";
 	ProjectSettings::get_singleton()->set_setting(COMMAND_QUEUE_SETTING, 1);
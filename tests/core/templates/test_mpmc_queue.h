@@ -0,0 +1,167 @@
+/**************************************************************************/
+/*  test_mpmc_queue.h                                                     */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#ifndef TEST_MPMC_QUEUE_H
+#define TEST_MPMC_QUEUE_H
+
+#include "core/os/os.h"
+#include "core/os/thread.h"
+#include "core/templates/local_vector.h"
+#include "core/templates/mpmc_queue.h"
+#include "core/templates/safe_refcount.h"
+
+#include "tests/test_macros.h"
+
+namespace TestMPMCQueue {
+
+TEST_CASE("[MPMCQueue] Elements are popped in push order") {
+	MPMCQueue<int, 8> queue;
+	int value = -1;
+
+	CHECK(queue.is_empty());
+	CHECK_FALSE(queue.pop(value));
+
+	for (int i = 0; i < 4; i++) {
+		CHECK(queue.push(i));
+	}
+	CHECK(queue.size() == 4);
+
+	for (int i = 0; i < 4; i++) {
+		CHECK(queue.pop(value));
+		CHECK(value == i);
+	}
+	CHECK(queue.is_empty());
+	CHECK_FALSE(queue.pop(value));
+}
+
+TEST_CASE("[MPMCQueue] Push fails when full and recovers after wrapping around") {
+	MPMCQueue<int, 4> queue;
+	int value = -1;
+
+	for (int lap = 0; lap < 3; lap++) {
+		for (int i = 0; i < 4; i++) {
+			CHECK(queue.push(lap * 4 + i));
+		}
+		CHECK_FALSE(queue.push(-1));
+		CHECK(queue.size() == queue.get_capacity());
+
+		for (int i = 0; i < 4; i++) {
+			CHECK(queue.pop(value));
+			CHECK(value == lap * 4 + i);
+		}
+		CHECK(queue.is_empty());
+	}
+}
+
+struct QueueData {
+	MPMCQueue<uint32_t, 64> *queue = nullptr;
+	LocalVector<SafeNumeric<uint32_t>> *taken = nullptr;
+	SafeNumeric<uint32_t> *next_element = nullptr;
+	SafeNumeric<uint32_t> *producers_left = nullptr;
+	uint32_t element_count = 0;
+};
+
+static void producer_thread_function(void *p_user) {
+	QueueData *data = (QueueData *)p_user;
+	while (true) {
+		uint32_t value = data->next_element->postincrement();
+		if (value >= data->element_count) {
+			break;
+		}
+		while (!data->queue->push(value)) {
+			OS::get_singleton()->delay_usec(1); // Full, wait for the consumers.
+		}
+	}
+	data->producers_left->decrement();
+}
+
+static void consumer_thread_function(void *p_user) {
+	QueueData *data = (QueueData *)p_user;
+	while (true) {
+		// Read the producer count first, so nothing pushed before they finished can be missed.
+		bool done = data->producers_left->get() == 0;
+		uint32_t value;
+		if (data->queue->pop(value)) {
+			(*data->taken)[value].increment();
+		} else if (done) {
+			break;
+		} else {
+			OS::get_singleton()->delay_usec(1);
+		}
+	}
+}
+
+TEST_CASE("[MPMCQueue] Every element is taken exactly once under contention") {
+	const uint32_t element_count = 20000;
+	const int producer_count = 3;
+	const int consumer_count = 3;
+
+	MPMCQueue<uint32_t, 64> queue;
+	LocalVector<SafeNumeric<uint32_t>> taken;
+	taken.resize(element_count);
+	SafeNumeric<uint32_t> next_element;
+	SafeNumeric<uint32_t> producers_left;
+	producers_left.set(producer_count);
+
+	QueueData data;
+	data.queue = &queue;
+	data.taken = &taken;
+	data.next_element = &next_element;
+	data.producers_left = &producers_left;
+	data.element_count = element_count;
+
+	Thread producers[producer_count];
+	Thread consumers[consumer_count];
+	for (int i = 0; i < consumer_count; i++) {
+		consumers[i].start(consumer_thread_function, &data);
+	}
+	for (int i = 0; i < producer_count; i++) {
+		producers[i].start(producer_thread_function, &data);
+	}
+
+	for (int i = 0; i < producer_count; i++) {
+		producers[i].wait_to_finish();
+	}
+	for (int i = 0; i < consumer_count; i++) {
+		consumers[i].wait_to_finish();
+	}
+
+	bool all_taken_once = true;
+	for (uint32_t i = 0; i < element_count; i++) {
+		// Reduce number of check messages.
+		all_taken_once &= taken[i].get() == 1;
+	}
+	CHECK(all_taken_once);
+	CHECK(queue.is_empty());
+}
+
+} // namespace TestMPMCQueue
+
+#endif // TEST_MPMC_QUEUE_H
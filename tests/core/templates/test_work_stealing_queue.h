@@ -0,0 +1,161 @@
+/**************************************************************************/
+/*  test_work_stealing_queue.h                                            */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#ifndef TEST_WORK_STEALING_QUEUE_H
+#define TEST_WORK_STEALING_QUEUE_H
+
+#include "core/os/thread.h"
+#include "core/templates/local_vector.h"
+#include "core/templates/safe_refcount.h"
+#include "core/templates/work_stealing_queue.h"
+
+#include "tests/test_macros.h"
+
+namespace TestWorkStealingQueue {
+
+TEST_CASE("[WorkStealingQueue] Owner pops newest, thieves steal oldest") {
+	WorkStealingQueue<int, 8> queue;
+	int value = -1;
+
+	CHECK(queue.is_empty());
+	CHECK_FALSE(queue.pop(value));
+	CHECK_FALSE(queue.steal(value));
+
+	for (int i = 0; i < 4; i++) {
+		CHECK(queue.push(i));
+	}
+	CHECK(queue.size() == 4);
+
+	CHECK(queue.pop(value));
+	CHECK(value == 3);
+	CHECK(queue.steal(value));
+	CHECK(value == 0);
+	CHECK(queue.pop(value));
+	CHECK(value == 2);
+	CHECK(queue.steal(value));
+	CHECK(value == 1);
+
+	CHECK(queue.is_empty());
+	CHECK_FALSE(queue.pop(value));
+	CHECK_FALSE(queue.steal(value));
+}
+
+TEST_CASE("[WorkStealingQueue] Push fails when full and recovers after wrapping around") {
+	WorkStealingQueue<int, 4> queue;
+	int value = -1;
+
+	for (int i = 0; i < 4; i++) {
+		CHECK(queue.push(i));
+	}
+	CHECK_FALSE(queue.push(4));
+	CHECK(queue.size() == queue.get_capacity());
+
+	CHECK(queue.steal(value));
+	CHECK(value == 0);
+	CHECK(queue.push(4));
+
+	for (int i = 1; i <= 4; i++) {
+		CHECK(queue.steal(value));
+		CHECK(value == i);
+	}
+	CHECK(queue.is_empty());
+}
+
+struct StealData {
+	WorkStealingQueue<uint32_t, 64> *queue = nullptr;
+	LocalVector<SafeNumeric<uint32_t>> *taken = nullptr;
+	SafeFlag *done = nullptr;
+};
+
+static void steal_thread_function(void *p_user) {
+	StealData *data = (StealData *)p_user;
+	while (true) {
+		// Read the flag first, so nothing pushed before it was set can be missed.
+		bool done = data->done->is_set();
+		uint32_t value;
+		if (data->queue->steal(value)) {
+			(*data->taken)[value].increment();
+		} else if (done && data->queue->is_empty()) {
+			break;
+		}
+	}
+}
+
+TEST_CASE("[WorkStealingQueue] Every element is taken exactly once under contention") {
+	const uint32_t element_count = 100000;
+	const int thief_count = 3;
+
+	WorkStealingQueue<uint32_t, 64> queue;
+	LocalVector<SafeNumeric<uint32_t>> taken;
+	taken.resize(element_count);
+	SafeFlag done;
+
+	StealData data;
+	data.queue = &queue;
+	data.taken = &taken;
+	data.done = &done;
+
+	Thread thieves[thief_count];
+	for (int i = 0; i < thief_count; i++) {
+		thieves[i].start(steal_thread_function, &data);
+	}
+
+	uint32_t value;
+	for (uint32_t i = 0; i < element_count; i++) {
+		while (!queue.push(i)) {
+			// Full, help draining it.
+			if (queue.pop(value)) {
+				taken[value].increment();
+			}
+		}
+		if (i % 3 == 0 && queue.pop(value)) {
+			taken[value].increment();
+		}
+	}
+	while (queue.pop(value)) {
+		taken[value].increment();
+	}
+	done.set();
+
+	for (int i = 0; i < thief_count; i++) {
+		thieves[i].wait_to_finish();
+	}
+
+	bool all_taken_once = true;
+	for (uint32_t i = 0; i < element_count; i++) {
+		// Reduce number of check messages.
+		all_taken_once &= taken[i].get() == 1;
+	}
+	CHECK(all_taken_once);
+}
+
+} // namespace TestWorkStealingQueue
+
+#endif // TEST_WORK_STEALING_QUEUE_H
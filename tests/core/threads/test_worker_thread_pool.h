@@ -106,6 +106,45 @@ TEST_CASE("[WorkerThreadPool] Process elements using group tasks") {
 	}
 }
 
+static void static_nested_inner_test(void *p_arg) {
+	counter[(uintptr_t)p_arg].increment();
+}
+static void static_nested_outer_test(void *p_arg) {
+	// Tasks posted from a pool thread go to its own queue, from which idle threads steal.
+	// While waiting, this thread keeps processing queued tasks, so this can't deadlock.
+	WorkerThreadPool::TaskID tasks[16];
+	for (int i = 0; i < 16; i++) {
+		tasks[i] = WorkerThreadPool::get_singleton()->add_native_task(static_nested_inner_test, (void *)((uintptr_t)p_arg * 16 + i), true);
+	}
+	for (int i = 0; i < 16; i++) {
+		WorkerThreadPool::get_singleton()->wait_for_task_completion(tasks[i]);
+	}
+}
+TEST_CASE("[WorkerThreadPool] Process tasks posted from pool threads") {
+	for (int iterations = 0; iterations < 100; iterations++) {
+		const int count = Math::pow(2.0f, Math::random(0.0f, 4.0f));
+
+		LocalVector<WorkerThreadPool::TaskID> tasks;
+		tasks.resize(count);
+
+		counter.clear();
+		counter.resize(count * 16);
+		for (int i = 0; i < count; i++) {
+			tasks[i] = WorkerThreadPool::get_singleton()->add_native_task(static_nested_outer_test, (void *)(uintptr_t)i, true);
+		}
+		for (int i = 0; i < count; i++) {
+			WorkerThreadPool::get_singleton()->wait_for_task_completion(tasks[i]);
+		}
+
+		bool all_run_once = true;
+		for (int i = 0; i < count * 16; i++) {
+			//Reduce number of check messages
+			all_run_once &= counter[i].get() == 1;
+		}
+		CHECK(all_run_once);
+	}
+}
+
 } // namespace TestWorkerThreadPool
 
 #endif // TEST_WORKER_THREAD_POOL_H
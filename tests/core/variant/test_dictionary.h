@@ -537,6 +537,132 @@ TEST_CASE("[Dictionary] Order and find") {
 	CHECK_EQ(d.find_key("does not exist"), Variant());
 }
 
+TEST_CASE("[Dictionary] Order after erasing and inserting again") {
+	Dictionary d;
+	for (int i = 0; i < 6; i++) {
+		d[i] = i * 10;
+	}
+	d.erase(1);
+	d.erase(4);
+	d[1] = 100;
+	d[2] = 200; // Already present, keeps its place.
+
+	Array keys = build_array(0, 2, 3, 5, 1);
+	CHECK_EQ(d.keys(), keys);
+	CHECK_EQ(d.values(), build_array(0, 200, 30, 50, 100));
+	CHECK_EQ(d.get_key_at_index(1), Variant(2));
+	CHECK_EQ(d.get_value_at_index(4), Variant(100));
+	CHECK_EQ(d.get_key_at_index(5), Variant());
+
+	Array iterated;
+	for (const Variant *key = d.next(); key; key = d.next(key)) {
+		iterated.push_back(*key);
+	}
+	CHECK_EQ(iterated, keys);
+}
+
+TEST_CASE("[Dictionary] Large dictionaries") {
+	Dictionary d;
+	const int count = 1000;
+	for (int i = 0; i < count; i++) {
+		d[vformat("key_%d", i)] = i;
+	}
+	CHECK(d.size() == count);
+
+	for (int i = 0; i < count; i += 2) {
+		CHECK(d.erase(vformat("key_%d", i)));
+	}
+	CHECK(d.size() == count / 2);
+	CHECK_FALSE(d.erase("key_0"));
+
+	bool found_all = true;
+	for (int i = 0; i < count; i++) {
+		bool has = d.has(vformat("key_%d", i));
+		if (has != (i % 2 == 1)) {
+			found_all = false;
+		}
+	}
+	CHECK(found_all);
+	CHECK_EQ(d.get_key_at_index(0), Variant("key_1"));
+	CHECK_EQ(d.get_value_at_index(count / 2 - 1), Variant(count - 1));
+
+	// StringName keys find the String keys they match.
+	CHECK(d.has(StringName("key_3")));
+	d[StringName("key_3")] = -3;
+	CHECK(d.size() == count / 2);
+	CHECK_EQ(d["key_3"], Variant(-3));
+
+	d.clear();
+	CHECK(d.is_empty());
+	CHECK_FALSE(d.has("key_1"));
+}
+
+TEST_CASE("[Dictionary] References to values stay valid while growing") {
+	Dictionary d;
+	Variant &first = d["first"];
+	first = 1;
+	for (int i = 0; i < 100; i++) {
+		d[i] = i;
+	}
+	first = 2;
+	CHECK_EQ(d["first"], Variant(2));
+}
+
+TEST_CASE("[Dictionary] References to values stay valid while erasing other keys") {
+	Dictionary d;
+	for (int i = 0; i < 20; i++) {
+		d[i] = i;
+	}
+	Variant &last = d[19];
+	Variant *ptr = d.getptr(18);
+	for (int i = 0; i < 18; i++) {
+		d.erase(i);
+	}
+	CHECK_EQ(&last, &d[19]);
+	CHECK_EQ(ptr, d.getptr(18));
+	last = 190;
+	*ptr = 180;
+	CHECK_EQ(d[19], Variant(190));
+	CHECK_EQ(d[18], Variant(180));
+
+	d[20] = 200;
+	CHECK_EQ(d.keys(), build_array(18, 19, 20));
+	CHECK_EQ(d.values(), build_array(180, 190, 200));
+	CHECK_EQ(d.get_key_at_index(0), Variant(18));
+}
+
+TEST_CASE("[Dictionary] References to values stay valid while inserting after erasing") {
+	Dictionary d;
+	for (int i = 0; i < 100; i++) {
+		d[i] = i;
+	}
+	for (int i = 0; i < 90; i++) {
+		d.erase(i);
+	}
+
+	Variant &kept = d[95];
+	Variant *ptr = d.getptr(99);
+	// The right-hand side is evaluated first, then inserting the new key reuses erased entries.
+	d[100] = d[95];
+	for (int i = 101; i < 200; i++) {
+		d[i] = i;
+	}
+	CHECK_EQ(&kept, &d[95]);
+	CHECK_EQ(ptr, d.getptr(99));
+	kept = 950;
+	*ptr = 990;
+	CHECK_EQ(d[95], Variant(950));
+	CHECK_EQ(d[99], Variant(990));
+	CHECK_EQ(d[100], Variant(95));
+
+	// Reused entries still follow the insertion order.
+	CHECK(d.size() == 110);
+	CHECK_EQ(d.get_key_at_index(0), Variant(90));
+	CHECK_EQ(d.get_key_at_index(9), Variant(99));
+	CHECK_EQ(d.get_key_at_index(10), Variant(100));
+	CHECK_EQ(d.get_value_at_index(109), Variant(199));
+}
+
 } // namespace TestDictionary
 
 #endif // TEST_DICTIONARY_H
@@ -2143,6 +2143,36 @@ struct MethodData {
 	bool is_vararg = false;
 };
 
+TEST_CASE("[Variant] Calling resolved built-in methods") {
+	Variant::BuiltInMethod length = Variant::get_builtin_method(Variant::VECTOR2, "length");
+	REQUIRE(length != nullptr);
+	CHECK(Variant::is_builtin_method_const(length));
+	CHECK(Variant::get_builtin_method(Variant::VECTOR2, "does_not_exist") == nullptr);
+
+	Variant vector = Vector2(3, 4);
+	Variant ret;
+	Callable::CallError ce;
+	vector.call_builtin_method(length, nullptr, 0, ret, ce);
+	CHECK(ce.error == Callable::CallError::CALL_OK);
+	CHECK(double(ret) == doctest::Approx(5));
+
+	// The method belongs to Vector2, so it can't be called on other types.
+	Variant string = "hello";
+	string.call_builtin_method(length, nullptr, 0, ret, ce);
+	CHECK(ce.error == Callable::CallError::CALL_ERROR_INVALID_METHOD);
+
+	Variant::BuiltInMethod append = Variant::get_builtin_method(Variant::ARRAY, "append");
+	REQUIRE(append != nullptr);
+	CHECK_FALSE(Variant::is_builtin_method_const(append));
+	Variant array = Array();
+	Variant value = 7;
+	const Variant *args[1] = { &value };
+	array.call_builtin_method(append, args, 1, ret, ce);
+	CHECK(ce.error == Callable::CallError::CALL_OK);
+	CHECK(Array(array).size() == 1);
+	CHECK(Array(array)[0] == Variant(7));
+}
+
 TEST_CASE("[Variant] Utility functions") {
 	List<MethodData> functions;
 
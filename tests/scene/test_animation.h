@@ -31,6 +31,9 @@
 #ifndef TEST_ANIMATION_H
 #define TEST_ANIMATION_H
 
+#include "scene/3d/node_3d.h"
+#include "scene/animation/animation_player.h"
+#include "scene/main/window.h"
 #include "scene/resources/animation.h"
 
 #include "tests/test_macros.h"
@@ -309,6 +312,141 @@ TEST_CASE("[Animation] Create Bezier track") {
 	ERR_PRINT_ON;
 }
 
+TEST_CASE("[Animation] Sampling with a track cursor gives the same results") {
+	Ref<Animation> animation = memnew(Animation);
+	animation->set_length(4.0);
+	animation->add_track(Animation::TYPE_POSITION_3D);
+	animation->add_track(Animation::TYPE_ROTATION_3D);
+	for (int i = 0; i < 40; i++) {
+		const double time = i * 0.1;
+		animation->position_track_insert_key(0, time, Vector3(Math::sin(time * 3.0), i % 3, -time));
+		animation->rotation_track_insert_key(1, time, Quaternion(Vector3(0, 1, 0), time));
+	}
+
+	// Forward playback, a loop back to the start, and jumps in both directions.
+	const double times[] = { -0.5, 0.0, 0.05, 0.1, 0.15, 0.2, 0.35, 0.5, 1.25, 3.9, 3.95, 4.0, 0.02, 0.07, 2.5, 1.0, 1.0, 1.03, 3.0 };
+
+	SUBCASE("Uncompressed tracks") {
+	}
+	SUBCASE("Compressed tracks") {
+		animation->compress();
+	}
+
+	Animation::TrackCursor position_cursor;
+	Animation::TrackCursor rotation_cursor;
+	for (double time : times) {
+		Vector3 position;
+		Vector3 position_with_cursor;
+		CHECK(animation->try_position_track_interpolate(0, time, &position) == OK);
+		CHECK(animation->try_position_track_interpolate(0, time, &position_with_cursor, &position_cursor) == OK);
+		CHECK(position == position_with_cursor);
+
+		Quaternion rotation;
+		Quaternion rotation_with_cursor;
+		CHECK(animation->try_rotation_track_interpolate(1, time, &rotation) == OK);
+		CHECK(animation->try_rotation_track_interpolate(1, time, &rotation_with_cursor, &rotation_cursor) == OK);
+		CHECK(rotation == rotation_with_cursor);
+	}
+}
+
+TEST_CASE("[SceneTree][Animation] Blending transform tracks sharing the same node") {
+	Node *parent = memnew(Node);
+	Node3D *target = memnew(Node3D);
+	target->set_name("Target");
+	AnimationPlayer *player = memnew(AnimationPlayer);
+	parent->add_child(target);
+	parent->add_child(player);
+	SceneTree::get_singleton()->get_root()->add_child(parent);
+
+	Ref<Animation> animation = memnew(Animation);
+	animation->add_track(Animation::TYPE_POSITION_3D);
+	animation->track_set_path(0, NodePath("Target"));
+	animation->position_track_insert_key(0, 0.0, Vector3(0, 0, 0));
+	animation->position_track_insert_key(0, 1.0, Vector3(2, 0, 0));
+	animation->add_track(Animation::TYPE_ROTATION_3D);
+	animation->track_set_path(1, NodePath("Target"));
+	animation->rotation_track_insert_key(1, 0.0, Quaternion());
+	animation->rotation_track_insert_key(1, 1.0, Quaternion(Vector3(0, 1, 0), Math_PI * 0.5));
+	animation->add_track(Animation::TYPE_SCALE_3D);
+	animation->track_set_path(2, NodePath("Target"));
+	animation->scale_track_insert_key(2, 0.0, Vector3(1, 1, 1));
+	animation->scale_track_insert_key(2, 1.0, Vector3(2, 2, 2));
+
+	Ref<AnimationLibrary> library = memnew(AnimationLibrary);
+	library->add_animation("move", animation);
+	player->add_animation_library("", library);
+	player->set_callback_mode_process(AnimationMixer::ANIMATION_CALLBACK_MODE_PROCESS_MANUAL);
+
+	// The three tracks share one cache, and must not dilute each other's weight when normalized.
+	player->set_deterministic(false);
+	player->play("move");
+	player->seek(0.5, true);
+
+	CHECK(target->get_position().is_equal_approx(Vector3(1, 0, 0)));
+	CHECK(target->get_quaternion().is_equal_approx(Quaternion(Vector3(0, 1, 0), Math_PI * 0.25)));
+	CHECK(target->get_scale().is_equal_approx(Vector3(1.5, 1.5, 1.5)));
+
+	// Changing the animation rebuilds the caches.
+	animation->position_track_insert_key(0, 1.0, Vector3(0, 4, 0));
+	player->seek(0.5, true);
+	CHECK(target->get_position().is_equal_approx(Vector3(0, 2, 0)));
+
+	memdelete(parent);
+}
+
+TEST_CASE("[SceneTree][Animation] Processing mixers in parallel") {
+	Ref<Animation> animation = memnew(Animation);
+	animation->add_track(Animation::TYPE_POSITION_3D);
+	animation->track_set_path(0, NodePath("Target"));
+	animation->position_track_insert_key(0, 0.0, Vector3(0, 0, 0));
+	animation->position_track_insert_key(0, 1.0, Vector3(2, 0, 0));
+	animation->add_track(Animation::TYPE_SCALE_3D);
+	animation->track_set_path(1, NodePath("Target"));
+	animation->scale_track_insert_key(1, 0.0, Vector3(1, 1, 1));
+	animation->scale_track_insert_key(1, 1.0, Vector3(2, 2, 2));
+	Ref<AnimationLibrary> library = memnew(AnimationLibrary);
+	library->add_animation("move", animation);
+
+	const int count = 8;
+	Node *parents[count];
+	Node3D *targets[count];
+	for (int i = 0; i < count; i++) {
+		parents[i] = memnew(Node);
+		targets[i] = memnew(Node3D);
+		targets[i]->set_name("Target");
+		AnimationPlayer *player = memnew(AnimationPlayer);
+		parents[i]->add_child(targets[i]);
+		parents[i]->add_child(player);
+		SceneTree::get_singleton()->get_root()->add_child(parents[i]);
+		player->add_animation_library("", library);
+		player->play("move");
+	}
+
+	// Half of the frames are processed in parallel, they should give the same results as the serial ones.
+	Vector3 positions[4];
+	Vector3 scales[4];
+	for (int frame = 0; frame < 4; frame++) {
+		AnimationMixer::set_parallel_processing_enabled(frame % 2 == 1);
+		SceneTree::get_singleton()->process(0.1);
+		positions[frame] = targets[0]->get_position();
+		scales[frame] = targets[0]->get_scale();
+		for (int i = 1; i < count; i++) {
+			CHECK(targets[i]->get_position().is_equal_approx(positions[frame]));
+			CHECK(targets[i]->get_scale().is_equal_approx(scales[frame]));
+		}
+	}
+	AnimationMixer::set_parallel_processing_enabled(false);
+
+	for (int frame = 1; frame < 4; frame++) {
+		CHECK(positions[frame].is_equal_approx(positions[frame - 1] + Vector3(0.2, 0, 0)));
+		CHECK(scales[frame].is_equal_approx(scales[frame - 1] + Vector3(0.1, 0.1, 0.1)));
+	}
+
+	for (int i = 0; i < count; i++) {
+		memdelete(parents[i]);
+	}
+}
+
 } // namespace TestAnimation
 
 #endif // TEST_ANIMATION_H
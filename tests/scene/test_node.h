@@ -762,6 +762,83 @@ TEST_CASE("[SceneTree][Node] Test the process priority") {
 	memdelete(node4);
 }
 
+TEST_CASE("[SceneTree][Node] Test the process priority across process thread groups") {
+	List<Node *> process_order;
+
+	TestNode *node = memnew(TestNode);
+	SceneTree::get_singleton()->get_root()->add_child(node);
+
+	TestNode *node2 = memnew(TestNode);
+	SceneTree::get_singleton()->get_root()->add_child(node2);
+
+	TestNode *node3 = memnew(TestNode);
+	SceneTree::get_singleton()->get_root()->add_child(node3);
+
+	TestNode *node4 = memnew(TestNode);
+	SceneTree::get_singleton()->get_root()->add_child(node4);
+
+	SUBCASE("Main thread groups follow the owner priority") {
+		TestNode *nodes[4] = { node, node2, node3, node4 };
+		int priorities[4] = { 20, 10, 40, 30 };
+		for (int i = 0; i < 4; i++) {
+			nodes[i]->callback_list = &process_order;
+			nodes[i]->set_process_thread_group(Node::PROCESS_THREAD_GROUP_MAIN_THREAD);
+			nodes[i]->set_process(true);
+			nodes[i]->set_process_priority(priorities[i]);
+			nodes[i]->set_physics_process(true);
+			nodes[i]->set_physics_process_priority(-priorities[i]);
+		}
+
+		SceneTree::get_singleton()->process(0);
+
+		CHECK_EQ(4, process_order.size());
+		List<Node *>::Element *E = process_order.front();
+		CHECK_EQ(E->get(), node2);
+		E = E->next();
+		CHECK_EQ(E->get(), node);
+		E = E->next();
+		CHECK_EQ(E->get(), node4);
+		E = E->next();
+		CHECK_EQ(E->get(), node3);
+
+		process_order.clear();
+		SceneTree::get_singleton()->physics_process(0);
+
+		CHECK_EQ(4, process_order.size());
+		E = process_order.front();
+		CHECK_EQ(E->get(), node3);
+		E = E->next();
+		CHECK_EQ(E->get(), node4);
+		E = E->next();
+		CHECK_EQ(E->get(), node);
+		E = E->next();
+		CHECK_EQ(E->get(), node2);
+	}
+
+	SUBCASE("Sub thread groups are all processed once") {
+		TestNode *nodes[4] = { node, node2, node3, node4 };
+		for (int i = 0; i < 4; i++) {
+			nodes[i]->set_process_thread_group(Node::PROCESS_THREAD_GROUP_SUB_THREAD);
+			nodes[i]->set_process(true);
+			nodes[i]->set_physics_process(true);
+		}
+
+		SceneTree::get_singleton()->process(0);
+		SceneTree::get_singleton()->physics_process(0);
+
+		for (int i = 0; i < 4; i++) {
+			CHECK_EQ(1, nodes[i]->process_counter);
+			CHECK_EQ(1, nodes[i]->physics_process_counter);
+		}
+		CHECK(SceneTree::get_singleton()->get_process_group_count() >= 4);
+	}
+
+	memdelete(node);
+	memdelete(node2);
+	memdelete(node3);
+	memdelete(node4);
+}
+
 } // namespace TestNode
 
 #endif // TEST_NODE_H
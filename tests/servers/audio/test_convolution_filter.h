@@ -0,0 +1,134 @@
+/**************************************************************************/
+/*  test_convolution_filter.h                                             */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#ifndef TEST_CONVOLUTION_FILTER_H
+#define TEST_CONVOLUTION_FILTER_H
+
+#include "core/math/random_number_generator.h"
+#include "servers/audio/effects/convolution_filter.h"
+
+#include "tests/test_macros.h"
+
+namespace TestConvolutionFilter {
+
+// Filters a random signal in uneven blocks and returns the largest difference
+// from a direct convolution, which the filter trails by one partition.
+static float max_error_against_direct(int p_impulse_length) {
+	Ref<RandomNumberGenerator> rng = memnew(RandomNumberGenerator);
+	rng->set_seed(p_impulse_length);
+
+	LocalVector<float> impulse;
+	impulse.resize(p_impulse_length);
+	for (int i = 0; i < p_impulse_length; i++) {
+		impulse[i] = rng->randf_range(-1.0, 1.0);
+	}
+
+	const int frames = ConvolutionFilter::PARTITION_SIZE * 6 + 37;
+	LocalVector<float> src;
+	LocalVector<float> dst;
+	src.resize(frames);
+	dst.resize(frames);
+	for (int i = 0; i < frames; i++) {
+		src[i] = rng->randf_range(-1.0, 1.0);
+	}
+
+	ConvolutionFilter::Kernel kernel;
+	ConvolutionFilter::make_kernel(impulse.ptr(), p_impulse_length, kernel);
+	CHECK(kernel.partition_count == (p_impulse_length + ConvolutionFilter::PARTITION_SIZE - 1) / ConvolutionFilter::PARTITION_SIZE);
+
+	ConvolutionFilter *filter = memnew(ConvolutionFilter);
+	filter->set_kernel(kernel);
+	for (int from = 0; from < frames; from += 100) {
+		filter->process(&src[from], &dst[from], MIN(100, frames - from));
+	}
+	memdelete(filter);
+
+	float max_error = 0.0f;
+	for (int i = 0; i < frames; i++) {
+		const int delayed = i - ConvolutionFilter::PARTITION_SIZE;
+		float expected = 0.0f;
+		for (int j = 0; j < p_impulse_length && j <= delayed; j++) {
+			expected += impulse[j] * src[delayed - j];
+		}
+		max_error = MAX(max_error, Math::abs(dst[i] - expected));
+	}
+	return max_error;
+}
+
+TEST_CASE("[ConvolutionFilter] Kernel shorter than one partition") {
+	CHECK(max_error_against_direct(100) < 1e-4);
+	CHECK(max_error_against_direct(ConvolutionFilter::PARTITION_SIZE) < 1e-4);
+}
+
+TEST_CASE("[ConvolutionFilter] Kernel spanning several partitions") {
+	CHECK(max_error_against_direct(700) < 1e-4);
+	CHECK(max_error_against_direct(ConvolutionFilter::PARTITION_SIZE * 4 + 1) < 1e-4);
+}
+
+TEST_CASE("[ConvolutionFilter] Output is delayed by one partition") {
+	const float impulse[1] = { 1.0f };
+	ConvolutionFilter::Kernel kernel;
+	ConvolutionFilter::make_kernel(impulse, 1, kernel);
+
+	float src[ConvolutionFilter::PARTITION_SIZE * 2] = {};
+	float dst[ConvolutionFilter::PARTITION_SIZE * 2];
+	src[3] = 1.0f;
+
+	ConvolutionFilter *filter = memnew(ConvolutionFilter);
+	filter->set_kernel(kernel);
+	filter->process(src, dst, ConvolutionFilter::PARTITION_SIZE * 2);
+	memdelete(filter);
+
+	for (int i = 0; i < ConvolutionFilter::PARTITION_SIZE * 2; i++) {
+		CHECK(dst[i] == doctest::Approx(i == ConvolutionFilter::PARTITION_SIZE + 3 ? 1.0f : 0.0f));
+	}
+}
+
+TEST_CASE("[ConvolutionFilter] Empty kernel outputs silence") {
+	ConvolutionFilter::Kernel kernel;
+	ConvolutionFilter::make_kernel(nullptr, 0, kernel);
+	CHECK(kernel.partition_count == 0);
+
+	const float src[4] = { 1.0f, -1.0f, 0.5f, 0.25f };
+	float dst[4] = { 1.0f, 1.0f, 1.0f, 1.0f };
+
+	ConvolutionFilter *filter = memnew(ConvolutionFilter);
+	filter->set_kernel(kernel);
+	filter->process(src, dst, 4);
+	memdelete(filter);
+
+	for (int i = 0; i < 4; i++) {
+		CHECK(dst[i] == 0.0f);
+	}
+}
+
+} // namespace TestConvolutionFilter
+
+#endif // TEST_CONVOLUTION_FILTER_H
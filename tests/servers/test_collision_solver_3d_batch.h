@@ -0,0 +1,122 @@
+/**************************************************************************/
+/*  test_collision_solver_3d_batch.h                                      */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#ifndef TEST_COLLISION_SOLVER_3D_BATCH_H
+#define TEST_COLLISION_SOLVER_3D_BATCH_H
+
+#include "core/math/random_number_generator.h"
+#include "servers/physics_3d/godot_collision_solver_3d_batch.h"
+
+#include "tests/test_macros.h"
+
+namespace TestCollisionSolver3DBatch {
+
+struct ContactResult {
+	int count = 0;
+	Vector3 point_A;
+	Vector3 point_B;
+	Vector3 normal;
+};
+
+static void contact_callback(const Vector3 &p_point_A, int p_index_A, const Vector3 &p_point_B, int p_index_B, const Vector3 &p_normal, void *p_userdata) {
+	ContactResult *result = static_cast<ContactResult *>(p_userdata);
+	result->count++;
+	result->point_A = p_point_A;
+	result->point_B = p_point_B;
+	result->normal = p_normal;
+}
+
+TEST_CASE("[CollisionSolver3DBatch] Results match the per pair solver") {
+	GodotSphereShape3D sphere;
+	sphere.set_data(0.5);
+	GodotCapsuleShape3D capsule;
+	Dictionary capsule_data;
+	capsule_data["radius"] = 0.3;
+	capsule_data["height"] = 2.0;
+	capsule.set_data(capsule_data);
+	GodotBoxShape3D box;
+	box.set_data(Vector3(0.5, 0.5, 0.5));
+
+	const GodotShape3D *shapes[2] = { &sphere, &capsule };
+
+	CHECK(GodotCollisionSolver3DBatch::is_pair_supported(&sphere, &capsule));
+	CHECK_FALSE(GodotCollisionSolver3DBatch::is_pair_supported(&sphere, &box));
+
+	Ref<RandomNumberGenerator> rng = memnew(RandomNumberGenerator);
+	rng->set_seed(1234);
+
+	const int pair_count = GodotCollisionSolver3DBatch::MAX_PAIRS;
+	const GodotShape3D *shapes_A[pair_count];
+	const GodotShape3D *shapes_B[pair_count];
+	Transform3D transforms_A[pair_count];
+	Transform3D transforms_B[pair_count];
+
+	GodotCollisionSolver3DBatch batch;
+	for (int i = 0; i < pair_count; i++) {
+		shapes_A[i] = shapes[i % 2];
+		shapes_B[i] = shapes[(i / 2) % 2];
+		transforms_A[i] = Transform3D(Basis(Vector3(rng->randf(), rng->randf(), rng->randf()).normalized(), rng->randf_range(-Math_PI, Math_PI)), Vector3(rng->randf_range(-1, 1), rng->randf_range(-1, 1), rng->randf_range(-1, 1)));
+		transforms_B[i] = Transform3D(Basis(Vector3(rng->randf(), rng->randf(), rng->randf()).normalized(), rng->randf_range(-Math_PI, Math_PI)), Vector3(rng->randf_range(-1, 1), rng->randf_range(-1, 1), rng->randf_range(-1, 1)));
+		CHECK(batch.add_pair(shapes_A[i], transforms_A[i], shapes_B[i], transforms_B[i]) == i);
+	}
+	CHECK(batch.is_full());
+	CHECK(batch.add_pair(&sphere, Transform3D(), &sphere, Transform3D()) == -1);
+
+	batch.solve();
+
+	int collided_count = 0;
+	bool all_match = true;
+	for (int i = 0; i < pair_count; i++) {
+		ContactResult expected;
+		ContactResult result;
+		bool expected_collided = GodotCollisionSolver3D::solve_static(shapes_A[i], transforms_A[i], shapes_B[i], transforms_B[i], contact_callback, &expected);
+		bool collided = batch.get_pair_result(i, contact_callback, &result);
+
+		collided_count += collided ? 1 : 0;
+		all_match &= collided == expected_collided;
+		all_match &= result.count == expected.count;
+		if (collided && expected_collided) {
+			all_match &= result.point_A.is_equal_approx(expected.point_A);
+			all_match &= result.point_B.is_equal_approx(expected.point_B);
+			all_match &= result.normal.is_equal_approx(expected.normal);
+		}
+	}
+	CHECK(all_match);
+	// Make sure both outcomes were tested.
+	CHECK(collided_count > 0);
+	CHECK(collided_count < pair_count);
+
+	batch.clear();
+	CHECK(batch.get_pair_count() == 0);
+}
+
+} // namespace TestCollisionSolver3DBatch
+
+#endif // TEST_COLLISION_SOLVER_3D_BATCH_H
@@ -78,6 +78,7 @@ TEST_SUITE("[Navigation]") {
 			CHECK_EQ(navigation_server->get_process_info(NavigationServer3D::INFO_EDGE_MERGE_COUNT), 0);
 			CHECK_EQ(navigation_server->get_process_info(NavigationServer3D::INFO_EDGE_CONNECTION_COUNT), 0);
 			CHECK_EQ(navigation_server->get_process_info(NavigationServer3D::INFO_EDGE_FREE_COUNT), 0);
+			CHECK_EQ(navigation_server->get_process_info(NavigationServer3D::INFO_PATH_QUERY_COUNT), 0);
 		}
 	}
 
@@ -160,6 +161,8 @@ TEST_SUITE("[Navigation]") {
 			navigation_server->map_set_up(map, Vector3(1, 0, 0));
 			bool initial_use_edge_connections = navigation_server->map_get_use_edge_connections(map);
 			navigation_server->map_set_use_edge_connections(map, !initial_use_edge_connections);
+			bool initial_use_hierarchical_pathfinding = navigation_server->map_get_use_hierarchical_pathfinding(map);
+			navigation_server->map_set_use_hierarchical_pathfinding(map, !initial_use_hierarchical_pathfinding);
 			navigation_server->process(0.0); // Give server some cycles to commit.
 
 			CHECK_EQ(navigation_server->map_get_cell_size(map), doctest::Approx(0.55));
@@ -167,6 +170,7 @@ TEST_SUITE("[Navigation]") {
 			CHECK_EQ(navigation_server->map_get_link_connection_radius(map), doctest::Approx(0.77));
 			CHECK_EQ(navigation_server->map_get_up(map), Vector3(1, 0, 0));
 			CHECK_EQ(navigation_server->map_get_use_edge_connections(map), !initial_use_edge_connections);
+			CHECK_EQ(navigation_server->map_get_use_hierarchical_pathfinding(map), !initial_use_hierarchical_pathfinding);
 		}
 
 		SUBCASE("'ProcessInfo' should report map iff active") {
@@ -716,6 +720,165 @@ TEST_SUITE("[Navigation]") {
 			CHECK_EQ(query_result->get_path_owner_ids().size(), 0);
 		}
 
+		SUBCASE("Batched queries should yield the same results as single queries") {
+			TypedArray<NavigationPathQueryParameters3D> batch_parameters;
+			TypedArray<NavigationPathQueryResult3D> batch_results;
+			for (int i = 0; i < 16; i++) {
+				Ref<NavigationPathQueryParameters3D> query_parameters = memnew(NavigationPathQueryParameters3D);
+				query_parameters->set_map(map);
+				query_parameters->set_start_position(Vector3(i * 0.5, 0, 0));
+				query_parameters->set_target_position(Vector3(10, 0, 10 - i * 0.5));
+				query_parameters->set_path_postprocessing(i % 2 ? NavigationPathQueryParameters3D::PATH_POSTPROCESSING_EDGECENTERED : NavigationPathQueryParameters3D::PATH_POSTPROCESSING_CORRIDORFUNNEL);
+				batch_parameters.push_back(query_parameters);
+				batch_results.push_back(memnew(NavigationPathQueryResult3D));
+			}
+			navigation_server->query_paths(batch_parameters, batch_results);
+
+			for (int i = 0; i < batch_parameters.size(); i++) {
+				Ref<NavigationPathQueryResult3D> query_result = memnew(NavigationPathQueryResult3D);
+				navigation_server->query_path(batch_parameters[i], query_result);
+				Ref<NavigationPathQueryResult3D> batch_result = batch_results[i];
+				CHECK_NE(batch_result->get_path().size(), 0);
+				CHECK_EQ(batch_result->get_path(), query_result->get_path());
+				CHECK_EQ(batch_result->get_path_rids(), query_result->get_path_rids());
+			}
+
+			navigation_server->process(0.0); // Update the counters.
+			CHECK_EQ(navigation_server->get_process_info(NavigationServer3D::INFO_PATH_QUERY_COUNT), 32);
+		}
+
+		navigation_server->free(region);
+		navigation_server->free(map);
+		navigation_server->process(0.0); // Give server some cycles to commit.
+	}
+
+	TEST_CASE("[NavigationServer3D] Hierarchical pathfinding should find the same routes as the flat search") {
+		NavigationServer3D *navigation_server = NavigationServer3D::get_singleton();
+
+		// A 4x4 grid of quads, its border edges matching the neighbor regions placed next to it.
+		Ref<NavigationMesh> navigation_mesh = memnew(NavigationMesh);
+		Vector<Vector3> vertices;
+		for (int z = 0; z <= 4; z++) {
+			for (int x = 0; x <= 4; x++) {
+				vertices.push_back(Vector3(x, 0, z));
+			}
+		}
+		navigation_mesh->set_vertices(vertices);
+		for (int z = 0; z < 4; z++) {
+			for (int x = 0; x < 4; x++) {
+				Vector<int> polygon;
+				polygon.push_back(z * 5 + x);
+				polygon.push_back(z * 5 + x + 1);
+				polygon.push_back((z + 1) * 5 + x + 1);
+				polygon.push_back((z + 1) * 5 + x);
+				navigation_mesh->add_polygon(polygon);
+			}
+		}
+
+		RID map = navigation_server->map_create();
+		navigation_server->map_set_active(map, true);
+		LocalVector<RID> regions;
+		for (int z = 0; z < 3; z++) {
+			for (int x = 0; x < 3; x++) {
+				RID region = navigation_server->region_create();
+				navigation_server->region_set_map(region, map);
+				navigation_server->region_set_transform(region, Transform3D(Basis(), Vector3(x * 4, 0, z * 4)));
+				navigation_server->region_set_navigation_mesh(region, navigation_mesh);
+				regions.push_back(region);
+			}
+		}
+		navigation_server->process(0.0); // Give server some cycles to commit.
+
+		const Vector3 queries[][2] = {
+			{ Vector3(0.5, 0, 0.5), Vector3(11.5, 0, 10.5) },
+			{ Vector3(0.5, 0, 11.5), Vector3(10.5, 0, 0.5) },
+			{ Vector3(1.5, 0, 6.5), Vector3(10.5, 0, 5.5) },
+			{ Vector3(5, 0, 0.5), Vector3(5, 0, 11.5) },
+		};
+
+		SUBCASE("Paths across regions should match") {
+			for (const Vector3 *query : queries) {
+				Vector<Vector3> flat_path = navigation_server->map_get_path(map, query[0], query[1], true);
+				navigation_server->map_set_use_hierarchical_pathfinding(map, true);
+				navigation_server->process(0.0); // Give server some cycles to commit.
+				Vector<Vector3> hierarchical_path = navigation_server->map_get_path(map, query[0], query[1], true);
+				navigation_server->map_set_use_hierarchical_pathfinding(map, false);
+				navigation_server->process(0.0);
+
+				CHECK_NE(flat_path.size(), 0);
+				CHECK_EQ(hierarchical_path, flat_path);
+			}
+		}
+
+		SUBCASE("Paths should route around a disabled region") {
+			navigation_server->region_set_enabled(regions[4], false);
+			navigation_server->process(0.0);
+			Vector<Vector3> flat_path = navigation_server->map_get_path(map, queries[3][0], queries[3][1], true);
+			navigation_server->map_set_use_hierarchical_pathfinding(map, true);
+			navigation_server->process(0.0);
+			Vector<Vector3> hierarchical_path = navigation_server->map_get_path(map, queries[3][0], queries[3][1], true);
+
+			CHECK_GT(flat_path.size(), 2);
+			CHECK_EQ(hierarchical_path, flat_path);
+		}
+
+		for (const RID &region : regions) {
+			navigation_server->free(region);
+		}
+		navigation_server->free(map);
+		navigation_server->process(0.0); // Give server some cycles to commit.
+	}
+
+	TEST_CASE("[NavigationServer3D] Hierarchical pathfinding should work inside a single large region") {
+		NavigationServer3D *navigation_server = NavigationServer3D::get_singleton();
+
+		// A 24x24 grid of quads, large enough to be split into several clusters.
+		const int size = 24;
+		Ref<NavigationMesh> navigation_mesh = memnew(NavigationMesh);
+		Vector<Vector3> vertices;
+		for (int z = 0; z <= size; z++) {
+			for (int x = 0; x <= size; x++) {
+				vertices.push_back(Vector3(x, 0, z));
+			}
+		}
+		navigation_mesh->set_vertices(vertices);
+		for (int z = 0; z < size; z++) {
+			for (int x = 0; x < size; x++) {
+				Vector<int> polygon;
+				polygon.push_back(z * (size + 1) + x);
+				polygon.push_back(z * (size + 1) + x + 1);
+				polygon.push_back((z + 1) * (size + 1) + x + 1);
+				polygon.push_back((z + 1) * (size + 1) + x);
+				navigation_mesh->add_polygon(polygon);
+			}
+		}
+
+		RID map = navigation_server->map_create();
+		navigation_server->map_set_active(map, true);
+		RID region = navigation_server->region_create();
+		navigation_server->region_set_map(region, map);
+		navigation_server->region_set_navigation_mesh(region, navigation_mesh);
+		navigation_server->process(0.0); // Give server some cycles to commit.
+
+		// Along a row of quads, the only shortest route is the straight one.
+		const Vector3 row_from = Vector3(0.5, 0, 12.5);
+		const Vector3 row_to = Vector3(23.5, 0, 12.5);
+		const Vector3 diagonal_from = Vector3(0.5, 0, 0.5);
+		const Vector3 diagonal_to = Vector3(23.5, 0, 23.5);
+
+		Vector<Vector3> flat_row_path = navigation_server->map_get_path(map, row_from, row_to, true);
+		navigation_server->map_set_use_hierarchical_pathfinding(map, true);
+		navigation_server->process(0.0); // Give server some cycles to commit.
+		Vector<Vector3> hierarchical_row_path = navigation_server->map_get_path(map, row_from, row_to, true);
+		Vector<Vector3> hierarchical_diagonal_path = navigation_server->map_get_path(map, diagonal_from, diagonal_to, true);
+
+		CHECK_NE(flat_row_path.size(), 0);
+		CHECK_EQ(hierarchical_row_path, flat_row_path);
+
+		REQUIRE_GE(hierarchical_diagonal_path.size(), 2);
+		CHECK_EQ(hierarchical_diagonal_path[0], diagonal_from);
+		CHECK_EQ(hierarchical_diagonal_path[hierarchical_diagonal_path.size() - 1], diagonal_to);
+
 		navigation_server->free(region);
 		navigation_server->free(map);
 		navigation_server->process(0.0); // Give server some cycles to commit.